@@ -0,0 +1,21 @@
+#version 330
+
+in vec2 fragTexCoord;
+in vec4 fragColor;
+out vec4 finalColor;
+
+// texture0: R = indice da paleta, A = cobertura
+uniform sampler2D texture0;
+uniform sampler2D palette;
+uniform float paletteRow;
+uniform vec4 colDiffuse;
+
+void main() {
+    vec4 indexed = texture(texture0, fragTexCoord);
+    if (indexed.a == 0.0) discard;
+
+    float index = floor(indexed.r * 255.0 + 0.5);
+    vec4 color = texture(palette, vec2((index + 0.5) / 256.0, paletteRow));
+
+    finalColor = color * colDiffuse * fragColor;
+}
\ No newline at end of file
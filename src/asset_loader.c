@@ -0,0 +1,186 @@
+#include "asset_loader.h"
+#include "asset_pack.h"
+#include "file_map.h"
+#include "shader_cache.h"
+#include <stdio.h>
+#include <string.h>
+
+#define ASSET_PATH_MAX 256
+
+static MappedFile packFile;
+static const PackEntry *packEntries = NULL;
+static const char *packStrings = NULL;
+static int packEntryCount = 0;
+
+static bool GetCompressedPath(const char *fileName, char *out, int size) {
+    const char *ext = strrchr(fileName, '.');
+    int baseLength = (ext != NULL) ? (int)(ext - fileName) : (int)strlen(fileName);
+    if (baseLength + 5 > size) return false;
+
+    memcpy(out, fileName, baseLength);
+    strcpy(out + baseLength, ".dds");
+    return true;
+}
+
+// Cada entrada precisa caber no arquivo mapeado: dados e caminho terminado em NUL
+static bool ArePackEntriesValid(const PackHeader *header) {
+    const PackEntry *entries = (const PackEntry *)(packFile.data + header->indexOffset);
+    uint64_t stringsSize = packFile.size - header->stringsOffset;
+    const char *strings = (const char *)(packFile.data + header->stringsOffset);
+
+    for (uint32_t i = 0; i < header->entryCount; i++) {
+        const PackEntry *entry = &entries[i];
+        if (entry->offset > packFile.size || entry->size > packFile.size - entry->offset) return false;
+        if (entry->pathOffset >= stringsSize) return false;
+        if (memchr(strings + entry->pathOffset, '\0', (size_t)(stringsSize - entry->pathOffset)) == NULL) return false;
+    }
+    return true;
+}
+
+bool Assets_OpenPack(const char *packPath) {
+    Assets_ClosePack();
+    if (!FileMap_Open(&packFile, packPath)) return false;
+
+    const PackHeader *header = (const PackHeader *)packFile.data;
+    bool isValid = packFile.size >= sizeof(PackHeader) &&
+                   header->magic == ASSET_PACK_MAGIC &&
+                   header->version == ASSET_PACK_VERSION &&
+                   header->indexOffset + (uint64_t)header->entryCount * sizeof(PackEntry) <= packFile.size &&
+                   header->stringsOffset <= packFile.size &&
+                   ArePackEntriesValid(header);
+
+    if (!isValid) {
+        printf("ASSETS: %s invalido, usando arquivos soltos\n", packPath);
+        FileMap_Close(&packFile);
+        return false;
+    }
+
+    packEntries = (const PackEntry *)(packFile.data + header->indexOffset);
+    packStrings = (const char *)(packFile.data + header->stringsOffset);
+    packEntryCount = (int)header->entryCount;
+
+    printf("ASSETS: %s mapeado (%d arquivos, %u KB)\n", packPath, packEntryCount, (unsigned int)(packFile.size / 1024));
+    return true;
+}
+
+void Assets_ClosePack(void) {
+    FileMap_Close(&packFile);
+    packEntries = NULL;
+    packStrings = NULL;
+    packEntryCount = 0;
+}
+
+// Busca binária pelo hash; caminhos com o mesmo hash são conferidos por nome
+static const PackEntry *FindPackEntry(const char *fileName) {
+    if (packEntryCount == 0) return NULL;
+
+    uint64_t hash = AssetPack_HashPath(fileName);
+    int low = 0, high = packEntryCount - 1;
+
+    while (low <= high) {
+        int mid = low + (high - low) / 2;
+        if (packEntries[mid].pathHash < hash) low = mid + 1;
+        else high = mid - 1;
+    }
+
+    for (int i = low; i < packEntryCount && packEntries[i].pathHash == hash; i++) {
+        if (strcmp(packStrings + packEntries[i].pathOffset, fileName) == 0) return &packEntries[i];
+    }
+    return NULL;
+}
+
+// Dados do pacote, ou NULL se o arquivo deve vir do disco
+static const unsigned char *GetPackData(const char *fileName, int *size) {
+#ifdef MM_LOOSE_ASSETS
+    if (FileExists(fileName)) return NULL;
+#endif
+
+    const PackEntry *entry = FindPackEntry(fileName);
+    if (entry == NULL) return NULL;
+
+    *size = (int)entry->size;
+    return packFile.data + entry->offset;
+}
+
+bool Assets_Exists(const char *fileName) {
+    return FindPackEntry(fileName) != NULL || FileExists(fileName);
+}
+
+Image Assets_LoadImage(const char *fileName) {
+    int size = 0;
+    const unsigned char *data = GetPackData(fileName, &size);
+    if (data != NULL) return LoadImageFromMemory(GetFileExtension(fileName), data, size);
+
+    return LoadImage(fileName);
+}
+
+Image Assets_DecodeTexture(const char *fileName) {
+    char compressedPath[ASSET_PATH_MAX];
+
+    if (GetCompressedPath(fileName, compressedPath, ASSET_PATH_MAX) && Assets_Exists(compressedPath)) {
+        Image image = Assets_LoadImage(compressedPath);
+        if (image.data != NULL) return image;
+    }
+
+    return Assets_LoadImage(fileName);
+}
+
+Texture2D Assets_UploadTexture(const char *fileName, Image image) {
+    bool isCompressed = image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB;
+    Texture2D texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+
+    if (texture.id == 0 && isCompressed) {
+        printf("ASSETS: Formato comprimido de %s nao suportado pela GPU, usando o original\n", fileName);
+        Image original = Assets_LoadImage(fileName);
+        texture = LoadTextureFromImage(original);
+        UnloadImage(original);
+    }
+    return texture;
+}
+
+Texture2D Assets_LoadTexture(const char *fileName) {
+    return Assets_UploadTexture(fileName, Assets_DecodeTexture(fileName));
+}
+
+// O stream lê direto do mapeamento: o pacote fica aberto até o fim do jogo
+Music Assets_LoadMusic(const char *fileName) {
+    int size = 0;
+    const unsigned char *data = GetPackData(fileName, &size);
+    if (data != NULL) return LoadMusicStreamFromMemory(GetFileExtension(fileName), data, size);
+
+    return LoadMusicStream(fileName);
+}
+
+Sound Assets_LoadSound(const char *fileName) {
+    int size = 0;
+    const unsigned char *data = GetPackData(fileName, &size);
+    if (data == NULL) return LoadSound(fileName);
+
+    Wave wave = LoadWaveFromMemory(GetFileExtension(fileName), data, size);
+    Sound sound = LoadSoundFromWave(wave);
+    UnloadWave(wave);
+    return sound;
+}
+
+Shader Assets_LoadShader(const char *fsFileName) {
+    char *code = Assets_LoadText(fsFileName);
+    Shader shader = ShaderCache_Load(fsFileName, code);
+    Assets_UnloadText(code);
+    return shader;
+}
+
+char *Assets_LoadText(const char *fileName) {
+    int size = 0;
+    const unsigned char *data = GetPackData(fileName, &size);
+    if (data == NULL) return LoadFileText(fileName);
+
+    char *text = (char *)MemAlloc(size + 1);
+    memcpy(text, data, size);
+    text[size] = '\0';
+    return text;
+}
+
+void Assets_UnloadText(char *text) {
+    if (text != NULL) MemFree(text);
+}
@@ -0,0 +1,31 @@
+#ifndef ASSET_LOADER_H
+#define ASSET_LOADER_H
+
+#include "raylib.h"
+
+// --- PROTÓTIPOS DE FUNÇÕES ---
+
+// Mapeia o assets.pak uma vez; sem ele tudo é lido dos arquivos soltos.
+// Com MM_LOOSE_ASSETS (builds de debug) o arquivo solto vence o pacote.
+bool Assets_OpenPack(const char *packPath);
+void Assets_ClosePack(void);
+bool Assets_Exists(const char *fileName);
+
+// Prefere a versão comprimida (.dds) gerada pelo tools/texcompress; sem ela,
+// ou sem suporte na GPU, usa o arquivo original.
+Texture2D Assets_LoadTexture(const char *fileName);
+
+// As duas metades do Assets_LoadTexture: a decodificação pode rodar em
+// qualquer thread, o envio para a GPU só na thread principal
+Image Assets_DecodeTexture(const char *fileName);
+Texture2D Assets_UploadTexture(const char *fileName, Image image);
+Image Assets_LoadImage(const char *fileName);
+Music Assets_LoadMusic(const char *fileName);
+Sound Assets_LoadSound(const char *fileName);
+Shader Assets_LoadShader(const char *fsFileName);
+
+// Texto terminado em '\0'; liberar com Assets_UnloadText
+char *Assets_LoadText(const char *fileName);
+void Assets_UnloadText(char *text);
+
+#endif
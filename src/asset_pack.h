@@ -0,0 +1,43 @@
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#include <stdint.h>
+
+// Formato do assets.pak (little-endian), gerado pelo tools/assetpack:
+//   PackHeader | dados (alinhados em 16) | PackEntry[entryCount] | caminhos
+// O índice vem ordenado por pathHash para busca binária.
+
+#define ASSET_PACK_MAGIC 0x4B504D4D    // "MMPK"
+#define ASSET_PACK_VERSION 1
+#define ASSET_PACK_ALIGNMENT 16
+
+// --- STRUCTS ---
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t reserved;
+    uint64_t indexOffset;
+    uint64_t stringsOffset;
+} PackHeader;
+
+typedef struct {
+    uint64_t pathHash;
+    uint64_t offset;
+    uint64_t size;
+    uint32_t pathOffset;        // relativo a stringsOffset
+    uint32_t contentHash;
+} PackEntry;
+
+// FNV-1a 64 bits do caminho ("assets/...", separador '/')
+static inline uint64_t AssetPack_HashPath(const char *path) {
+    uint64_t hash = 14695981039346656037ull;
+    for (const unsigned char *c = (const unsigned char *)path; *c != '\0'; c++) {
+        hash ^= *c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+#endif
@@ -0,0 +1,121 @@
+#include "character_registry.h"
+#include <stddef.h>
+
+#ifdef MM_EMBED_MOVESETS
+#include "embedded_movesets.h"
+#endif
+
+// --- BACTERIÓFAGO ---
+
+static void Bacteriophage_DrawOverride(const Player *player, const PlayerVisual *visual, SpritePose *pose) {
+    // Quadro do foguete: gira pelo centro na direção do voo
+    if (player->state != PLAYER_STATE_ATTACK || visual->currentAnimIndex != 19) return;
+    pose->centerPivot = true;
+
+    switch (Character_MoveSlot(player, player->currentMove)) {
+        case MOVE_SLOT_SPECIAL_SIDE: pose->rotation = player->isFlipped ? -90.0f : 90.0f; break;
+        case MOVE_SLOT_ULTIMATE:     pose->rotation = (player->velocity.y > 0) ? 180.0f : 0.0f; break;
+        default: break;
+    }
+}
+
+static bool Bacteriophage_TrapVisual(const Player *owner, MoveSlot slot) {
+    (void)owner;
+    return slot == MOVE_SLOT_AIR_NEUTRAL;       // explosão de esporos
+}
+
+// --- AMEBA ---
+
+static void Amoeba_OnMoveStart(Player *player, const Move *move) {
+    (void)move;
+    player->velocity = (Vector2){ 0, 0 };
+}
+
+static void Amoeba_OnTick(Player *player) {
+    // Forma gigante não é interrompida por projéteis
+    player->hasSuperArmor = (player->state == PLAYER_STATE_ATTACK &&
+                             player->currentMove != NULL &&
+                             player->currentMove->type == MOVE_TYPE_ULTIMATE);
+}
+
+// Forma gigante: dano contínuo a cada 20 frames de contato
+static HitResult Amoeba_OnHit(Player *attacker, Player *victim, HitboxNode *hitbox) {
+    if (hitbox->moveType != MOVE_TYPE_ULTIMATE) return HIT_DEFAULT;
+    if (hitbox->lifetime % 20 != 0) return HIT_IGNORED;
+
+    victim->currentHealth -= hitbox->damage;
+
+    float kbDir = (attacker->position.x < victim->position.x) ? 2.0f : -2.0f;
+    victim->velocity.x = hitbox->knockback.x * kbDir;
+    victim->velocity.y = hitbox->knockback.y;
+
+    victim->state = PLAYER_STATE_HURT;
+    victim->attackFrameCounter = 15;
+    return HIT_HANDLED;
+}
+
+static void Amoeba_DrawOverride(const Player *player, const PlayerVisual *visual, SpritePose *pose) {
+    (void)visual;
+    if (player->state == PLAYER_STATE_ATTACK && Character_MoveSlot(player, player->currentMove) == MOVE_SLOT_ULTIMATE) {
+        pose->scale = 9.0f;
+    }
+}
+
+// --- REGISTRO ---
+
+static Moveset *movesets[CHARACTER_COUNT];     // só os lidos do JSON; os embutidos não são liberados
+
+static const CharacterDef characters[CHARACTER_COUNT] = {
+    [CHARACTER_BACTERIOPHAGE] = {
+        CHARACTER_BACTERIOPHAGE, "Bacteriophage", "assets/data/bacteriophage.json",
+        "assets/Bacteriofago.atlas.json", "assets/Bacteriofago.png", 64, 64,
+        "assets/bacteriophage_icon.png",
+        { .drawOverride = Bacteriophage_DrawOverride, .trapVisual = Bacteriophage_TrapVisual }
+    },
+    [CHARACTER_AMOEBA] = {
+        CHARACTER_AMOEBA, "Amoeba", "assets/data/amoeba.json",
+        "assets/Ameba.atlas.json", "assets/Ameba.png", 56, 56,
+        "assets/amoeba_icon.png",
+        { .onMoveStart = Amoeba_OnMoveStart, .onTick = Amoeba_OnTick,
+          .onHit = Amoeba_OnHit, .drawOverride = Amoeba_DrawOverride }
+    }
+};
+
+const CharacterDef *Character_Get(int id) {
+    if (id < 0 || id >= CHARACTER_COUNT) return &characters[CHARACTER_BACTERIOPHAGE];
+    return &characters[id];
+}
+
+const Moveset *Character_GetMoveset(const CharacterDef *character) {
+#ifdef MM_EMBED_MOVESETS
+    // Mesma regra do asset_loader: com MM_LOOSE_ASSETS o JSON solto vence
+    bool isOverridden = false;
+#ifdef MM_LOOSE_ASSETS
+    isOverridden = FileExists(character->movesetFile);
+#endif
+    const Moveset *embedded = isOverridden ? NULL : EmbeddedMoveset_Find(character->movesetFile);
+    if (embedded != NULL) return embedded;
+#endif
+
+    if (movesets[character->id] == NULL) {
+        movesets[character->id] = LoadMovesetFromJSON(character->movesetFile);
+    }
+    return movesets[character->id];
+}
+
+void Character_UnloadMovesets(void) {
+    for (int i = 0; i < CHARACTER_COUNT; i++) {
+        UnloadMoveset(movesets[i]);
+        movesets[i] = NULL;
+    }
+}
+
+int Character_MoveSlot(const Player *player, const Move *move) {
+    if (player->moves == NULL || move == NULL) return -1;
+
+    // Comparação, não subtração: o golpe pode ser um Move local (nuvem, explosão)
+    for (int i = 0; i < MOVE_SLOT_COUNT; i++) {
+        if (&player->moves->list[i] == move) return i;
+    }
+    return -1;
+}
@@ -0,0 +1,65 @@
+#ifndef CHARACTER_REGISTRY_H
+#define CHARACTER_REGISTRY_H
+
+#include "game_scene.h"
+
+// --- ENUMS ---
+
+typedef enum {
+    CHARACTER_BACTERIOPHAGE,
+    CHARACTER_AMOEBA,
+    CHARACTER_COUNT
+} CharacterID;
+
+typedef enum {
+    HIT_DEFAULT,        // regras normais: dano, knockback, hitbox consumido
+    HIT_HANDLED,        // o gancho aplicou o golpe; o hitbox continua ativo
+    HIT_IGNORED         // contato sem efeito neste tick; o hitbox continua ativo
+} HitResult;
+
+// --- STRUCTS ---
+
+// Como o sprite do jogador é desenhado neste frame; drawOverride pode mudar
+typedef struct {
+    float scale;
+    float rotation;
+    bool centerPivot;           // gira em torno do centro, não dos pés
+} SpritePose;
+
+// Comportamento próprio de um personagem. Qualquer gancho pode ser NULL.
+typedef struct {
+    void (*onMoveStart)(Player *player, const Move *move);
+    void (*onTick)(Player *player);                     // depois do passo de física
+    HitResult (*onHit)(Player *attacker, Player *victim, HitboxNode *hitbox);
+    void (*drawOverride)(const Player *player, const PlayerVisual *visual, SpritePose *pose);
+    bool (*trapVisual)(const Player *owner, MoveSlot slot);     // true: armadilha desenhada por partículas
+} CharacterHooks;
+
+typedef struct CharacterDef {
+    CharacterID id;
+    const char *name;
+    const char *movesetFile;
+    const char *atlasFile;
+    const char *sheetFile;      // folha original, se o atlas recortado não existir
+    int frameWidth;
+    int frameHeight;
+    const char *iconFile;
+    CharacterHooks hooks;
+} CharacterDef;
+
+// --- PROTÓTIPOS DE FUNÇÕES ---
+
+// IDs fora do registro caem no Bacteriófago
+const CharacterDef *Character_Get(int id);
+
+// Carrega na primeira chamada e reaproveita em todas as partidas seguintes
+// (espelho incluso). Só leitura: o estado mutável fica no Player. Com
+// MM_EMBED_MOVESETS os personagens embutidos nem passam pelo JSON, a não
+// ser que MM_LOOSE_ASSETS esteja ligado e exista o arquivo solto.
+const Moveset *Character_GetMoveset(const CharacterDef *character);
+void Character_UnloadMovesets(void);
+
+// Slot do golpe no moveset do jogador, ou -1 (golpes montados na hora)
+int Character_MoveSlot(const Player *player, const Move *move);
+
+#endif
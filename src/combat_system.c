@@ -1,18 +1,57 @@
 #include "game_scene.h"
+#include "character_registry.h"
 #include "raymath.h"
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 #define BODY_WIDTH 50.0f
 #define BODY_HEIGHT 90.0f
+#define COMBAT_EVENT_CAPACITY 64
+
+// Um buffer só, de quem apresenta; cada mundo decide se registra nele
+static CombatEvent events[COMBAT_EVENT_CAPACITY];
+static int eventCount = 0;
+static unsigned int eventTick = 0;
+
+static void PushEvent(CombatWorld *world, CombatEventType type, Vector2 position, bool isPlayer1, MoveEffect effect, MoveType moveType, bool hasParticleVisual) {
+    if (!world->isRecordingEvents || eventCount >= COMBAT_EVENT_CAPACITY) return;
+    events[eventCount++] = (CombatEvent){
+        .type = type, .tick = eventTick, .position = position, .isPlayer1 = isPlayer1,
+        .effect = effect, .moveType = moveType, .hasParticleVisual = hasParticleVisual
+    };
+}
+
+static Vector2 RectCenter(Rectangle rect) {
+    return (Vector2){ rect.x + rect.width / 2.0f, rect.y + rect.height / 2.0f };
+}
 
-static HitboxNode *activeHitboxes = NULL;
-static ProjectileNode *activeProjectiles = NULL;
-static TrapNode *activeTraps = NULL;
+static void PushHit(CombatWorld *world, Rectangle victimBody, bool isPlayer1, MoveEffect effect, MoveType moveType) {
+    PushEvent(world, COMBAT_EVENT_HIT, RectCenter(victimBody), isPlayer1, effect, moveType, false);
+}
 
-static void SpawnHitbox(Player *attacker, Move *move, bool isPlayer1) {
-    HitboxNode *newNode = (HitboxNode*)malloc(sizeof(HitboxNode));
-    if (!newNode) return;
+void Combat_BeginTick(unsigned int tick) {
+    eventTick = tick;
+    eventCount = 0;
+}
+
+void Combat_SetEventsEnabled(CombatWorld *world, bool enabled) {
+    world->isRecordingEvents = enabled;
+}
+
+void Combat_EmitEffect(CombatWorld *world, CombatEventType type, Vector2 position, float rotation) {
+    if (!world->isRecordingEvents || eventCount >= COMBAT_EVENT_CAPACITY) return;
+    events[eventCount++] = (CombatEvent){ .type = type, .tick = eventTick, .position = position, .rotation = rotation };
+}
+
+const CombatEvent *Combat_GetEvents(int *count) {
+    *count = eventCount;
+    return events;
+}
+
+static void SpawnHitbox(CombatWorld *world, Player *attacker, const Move *move, bool isPlayer1) {
+    if (world->hitboxCount >= COMBAT_MAX_HITBOXES) return;
+    HitboxNode *newNode = &world->hitboxes[world->hitboxCount++];
 
     Rectangle hitboxRect = move->hitbox;
     
@@ -35,14 +74,11 @@ static void SpawnHitbox(Player *attacker, Move *move, bool isPlayer1) {
     newNode->effect = move->effect;
     newNode->effectDuration = move->effectDuration;
     newNode->moveType = move->type;
-    
-    newNode->next = activeHitboxes;
-    activeHitboxes = newNode;
 }
 
-static void SpawnProjectile(Player *attacker, Move *move, bool isPlayer1) {
-    ProjectileNode *p = (ProjectileNode*)malloc(sizeof(ProjectileNode));
-    if (!p) return;
+static void SpawnProjectile(CombatWorld *world, Player *attacker, const Move *move, bool isPlayer1) {
+    if (world->projectileCount >= COMBAT_MAX_PROJECTILES) return;
+    ProjectileNode *p = &world->projectiles[world->projectileCount++];
 
     float dir = attacker->isFlipped ? -1.0f : 1.0f;
     float offsetX = attacker->isFlipped ? (-move->hitbox.x - move->hitbox.width) : move->hitbox.x;
@@ -62,13 +98,12 @@ static void SpawnProjectile(Player *attacker, Move *move, bool isPlayer1) {
     
     p->isPlayer1 = isPlayer1;
 
-    p->next = activeProjectiles;
-    activeProjectiles = p;
+    PushEvent(world, COMBAT_EVENT_PROJECTILE_SPAWN, p->position, isPlayer1, p->effect, p->moveType, false);
 }
 
-static void SpawnTrap(Vector2 pos, Rectangle size, float damage, float duration, bool isP1, MoveEffect effect, MoveType type) {
-    TrapNode *t = (TrapNode*)malloc(sizeof(TrapNode));
-    if (!t) return;
+static TrapNode *SpawnTrap(CombatWorld *world, Vector2 pos, Rectangle size, float damage, float duration, bool isP1, MoveEffect effect, MoveType type, bool hasParticleVisual) {
+    if (world->trapCount >= COMBAT_MAX_TRAPS) return NULL;
+    TrapNode *t = &world->traps[world->trapCount++];
 
     t->area = size;
     t->area.x = pos.x;
@@ -78,42 +113,51 @@ static void SpawnTrap(Vector2 pos, Rectangle size, float damage, float duration,
     t->isPlayer1 = isP1;
     t->effect = effect;
     t->moveType = type;
+    t->hasParticleVisual = hasParticleVisual;
     
-    t->next = activeTraps;
-    activeTraps = t;
+    PushEvent(world, COMBAT_EVENT_TRAP_SPAWN, RectCenter(t->area), isP1, effect, type, hasParticleVisual);
+    return t;
 }
 
-void Combat_TryExecuteMove(Player *player, Move *move, bool isPlayer1) {
+void Combat_TryExecuteMove(CombatWorld *world, Player *player, const Move *move, bool isPlayer1) {
     if (move->type == MOVE_TYPE_TRAP_PROJECTILE) {
         if (player->isGrounded) {
             Rectangle trapRect = move->hitbox;
             float dir = player->isFlipped ? -1.0f : 1.0f;
             float offsetX = player->isFlipped ? (-trapRect.x - trapRect.width) : trapRect.x;
             Vector2 pos = { player->position.x + offsetX, GROUND_LEVEL - trapRect.height }; 
-            SpawnTrap(pos, trapRect, move->damage, move->trapDuration * 60, isPlayer1, move->effect, move->type);
+            SpawnTrap(world, pos, trapRect, move->damage, move->trapDuration * 60, isPlayer1, move->effect, move->type, false);
         } else {
-            SpawnProjectile(player, move, isPlayer1);
+            SpawnProjectile(world, player, move, isPlayer1);
         }
     }
     else if (move->type == MOVE_TYPE_PROJECTILE || move->type == MOVE_TYPE_PROJECTILE_INSTANT) {
-        SpawnProjectile(player, move, isPlayer1);
+        SpawnProjectile(world, player, move, isPlayer1);
     }
     else if (move->type == MOVE_TYPE_TRAP) {
         Rectangle trapRect = move->hitbox;
         float dir = player->isFlipped ? -1.0f : 1.0f;
         float offsetX = player->isFlipped ? (-trapRect.x - trapRect.width) : trapRect.x;
         Vector2 pos = { player->position.x + offsetX, player->position.y + trapRect.y };
-        SpawnTrap(pos, trapRect, move->damage, move->effectDuration * 60, isPlayer1, move->effect, move->type);
+
+        // O visual é decidido aqui, uma vez; armadilha de partículas segue sozinha no sistema de partículas
+        bool hasParticleVisual = false;
+        if (player->character->hooks.trapVisual) {
+            int slot = Character_MoveSlot(player, move);
+            hasParticleVisual = (slot >= 0) && player->character->hooks.trapVisual(player, (MoveSlot)slot);
+        }
+        SpawnTrap(world, pos, trapRect, move->damage, move->effectDuration * 60, isPlayer1, move->effect, move->type, hasParticleVisual);
     }
     else {
-        SpawnHitbox(player, move, isPlayer1);
+        SpawnHitbox(world, player, move, isPlayer1);
     }
 }
 
-void Combat_Update(Player *p1, Player *p2) {
-    ProjectileNode *proj = activeProjectiles;
-    ProjectileNode *prevProj = NULL;
-    while (proj != NULL) {
+void Combat_Update(CombatWorld *world, Player *p1, Player *p2) {
+    // Remoções compactam o vetor mantendo a ordem de criação
+    int kept = 0;
+    for (int i = 0; i < world->projectileCount; i++) {
+        ProjectileNode *proj = &world->projectiles[i];
         proj->position.x += proj->velocity.x;
         proj->position.y += proj->velocity.y;
         proj->lifetime--;
@@ -121,38 +165,32 @@ void Combat_Update(Player *p1, Player *p2) {
         bool hitGround = false;
         if (proj->spawnTrapOnGround && proj->position.y >= GROUND_LEVEL - proj->size.height) {
             hitGround = true;
-            SpawnTrap(proj->position, proj->size, proj->damage, proj->trapDuration, proj->isPlayer1, proj->effect, proj->moveType);
+            SpawnTrap(world, proj->position, proj->size, proj->damage, proj->trapDuration, proj->isPlayer1, proj->effect, proj->moveType, false);
         }
 
         if (proj->lifetime <= 0 || hitGround || proj->position.x < -200 || proj->position.x > GAME_WIDTH + 200) {
-            ProjectileNode *toFree = proj;
-            if (prevProj) prevProj->next = proj->next; else activeProjectiles = proj->next;
-            proj = proj->next;
-            free(toFree);
+            PushEvent(world, COMBAT_EVENT_PROJECTILE_EXPIRE, proj->position, proj->isPlayer1, proj->effect, proj->moveType, false);
         } else {
-            prevProj = proj;
-            proj = proj->next;
+            world->projectiles[kept++] = *proj;
         }
     }
+    world->projectileCount = kept;
 
-    TrapNode *trap = activeTraps;
-    TrapNode *prevTrap = NULL;
-    while (trap != NULL) {
+    kept = 0;
+    for (int i = 0; i < world->trapCount; i++) {
+        TrapNode *trap = &world->traps[i];
         trap->duration--;
         if (trap->duration <= 0) {
-            TrapNode *toFree = trap;
-            if (prevTrap) prevTrap->next = trap->next; else activeTraps = trap->next;
-            trap = trap->next;
-            free(toFree);
+            PushEvent(world, COMBAT_EVENT_TRAP_EXPIRE, RectCenter(trap->area), trap->isPlayer1, trap->effect, trap->moveType, trap->hasParticleVisual);
         } else {
-            prevTrap = trap;
-            trap = trap->next;
+            world->traps[kept++] = *trap;
         }
     }
+    world->trapCount = kept;
 
-    HitboxNode *hb = activeHitboxes;
-    HitboxNode *prevHb = NULL;
-    while (hb != NULL) {
+    kept = 0;
+    for (int i = 0; i < world->hitboxCount; i++) {
+        HitboxNode *hb = &world->hitboxes[i];
         hb->lifetime--;
 
         Player *owner = hb->isPlayer1 ? p1 : p2;
@@ -171,16 +209,11 @@ void Combat_Update(Player *p1, Player *p2) {
             hb->size.height = GROUND_LEVEL - hb->size.y;
         }
 
-        if (hb->lifetime <= 0 || hb->size.width <= 0 || hb->size.height <= 0) {
-            HitboxNode *toFree = hb;
-            if (prevHb) prevHb->next = hb->next; else activeHitboxes = hb->next;
-            hb = hb->next;
-            free(toFree);
-        } else {
-            prevHb = hb;
-            hb = hb->next;
+        if (hb->lifetime > 0 && hb->size.width > 0 && hb->size.height > 0) {
+            world->hitboxes[kept++] = *hb;
         }
     }
+    world->hitboxCount = kept;
 
     Rectangle body1 = { 
         p1->position.x - (BODY_WIDTH/2), 
@@ -195,29 +228,18 @@ void Combat_Update(Player *p1, Player *p2) {
         BODY_HEIGHT 
     };
 
-    proj = activeProjectiles;
-    prevProj = NULL;
-    while (proj != NULL) {
+    kept = 0;
+    for (int i = 0; i < world->projectileCount; i++) {
+        ProjectileNode *proj = &world->projectiles[i];
+        bool consumed = false;
         Player *victim = proj->isPlayer1 ? p2 : p1;
         Rectangle victimBody = proj->isPlayer1 ? body2 : body1;
         
         if (CheckCollisionRecs((Rectangle){proj->position.x, proj->position.y, proj->size.width, proj->size.height}, victimBody)) {
             victim->currentHealth -= proj->damage;
+            PushHit(world, victimBody, proj->isPlayer1, proj->effect, proj->moveType);
 
-            if (proj->effect != EFFECT_POISON) {
-                Vector2 spawnPos = {
-                    victimBody.x + victimBody.width / 2.0f,
-                    victimBody.y + victimBody.height / 2.0f
-                };
-                SpawnVfx(spawnPos, 0.0f, texHitVfx, 8, 0.04f, 1.0f);
-                PlayHurtSound();
-            }
-
-            bool hasSuperArmor = (victim->characterID == 1 && 
-                                  victim->currentMove != NULL && 
-                                  victim->currentMove->type == MOVE_TYPE_ULTIMATE);
-
-            if (!hasSuperArmor) {
+            if (!victim->hasSuperArmor) {
                 victim->state = PLAYER_STATE_HURT;
             }
 
@@ -234,62 +256,33 @@ void Combat_Update(Player *p1, Player *p2) {
 
                 attacker->currentUlt = (int)(attacker->ultCharge / attacker->chargePerPill);
                 victim->currentUlt = (int)(victim->ultCharge / victim->chargePerPill);
-
-                ProjectileNode *toFree = proj;
-                if (prevProj) prevProj->next = proj->next; else activeProjectiles = proj->next;
-                proj = proj->next;
-                free(toFree);
+                consumed = true;
             }
-        } else {
-            prevProj = proj;
-            proj = proj->next;
         }
+
+        if (!consumed) world->projectiles[kept++] = *proj;
     }
+    world->projectileCount = kept;
 
-    hb = activeHitboxes;
-    prevHb = NULL;
-    while (hb != NULL) {
+    kept = 0;
+    for (int i = 0; i < world->hitboxCount; i++) {
+        HitboxNode *hb = &world->hitboxes[i];
         Player *victim = hb->isPlayer1 ? p2 : p1;
         Player *attacker = hb->isPlayer1 ? p1 : p2;
         Rectangle victimBody = hb->isPlayer1 ? body2 : body1;
         
         if (CheckCollisionRecs(hb->size, victimBody)) {
-            if (hb->moveType == MOVE_TYPE_ULTIMATE && attacker->characterID == 1) {
-                
-                if (hb->lifetime % 20 == 0) {
-                    victim->currentHealth -= hb->damage;
-                    
-                    Vector2 spawnPos = {
-                        victimBody.x + victimBody.width / 2.0f,
-                        victimBody.y + victimBody.height / 2.0f
-                    };
-                    SpawnVfx(spawnPos, 0.0f, texHitVfx, 8, 0.04f, 1.0f);
-                    PlayHurtSound();
-                    
-                    float kbDir = (attacker->position.x < victim->position.x) ? 2.0f : -2.0f;
-                    victim->velocity.x = hb->knockback.x * kbDir;
-                    victim->velocity.y = hb->knockback.y;
-                    
-                    victim->state = PLAYER_STATE_HURT;
-                    victim->attackFrameCounter = 15;
-                }
+            HitResult result = attacker->character->hooks.onHit ? attacker->character->hooks.onHit(attacker, victim, hb) : HIT_DEFAULT;
+            if (result != HIT_DEFAULT) {
+                if (result == HIT_HANDLED) PushHit(world, victimBody, hb->isPlayer1, hb->effect, hb->moveType);
 
-                prevHb = hb;
-                hb = hb->next;
+                world->hitboxes[kept++] = *hb;
                 continue; 
             }
 
             victim->currentHealth -= hb->damage;
             if (hb->effect == EFFECT_POISON) victim->poisonTimer = hb->effectDuration;
-
-            if (hb->effect != EFFECT_POISON) {
-                Vector2 spawnPos = {
-                    victimBody.x + victimBody.width / 2.0f,
-                    victimBody.y + victimBody.height / 2.0f
-                };
-                SpawnVfx(spawnPos, 0.0f, texHitVfx, 8, 0.04f, 1.0f);
-                PlayHurtSound();
-            }
+            PushHit(world, victimBody, hb->isPlayer1, hb->effect, hb->moveType);
 
             if (hb->moveType != MOVE_TYPE_ULTIMATE && hb->moveType != MOVE_TYPE_ULTIMATE_FALL) {
                 float gainAttacker = hb->damage * 5.0f; 
@@ -322,37 +315,23 @@ void Combat_Update(Player *p1, Player *p2) {
             
             victim->state = PLAYER_STATE_HURT;
             victim->attackFrameCounter = 30; 
-
-            HitboxNode *toFree = hb;
-            if (prevHb) prevHb->next = hb->next; else activeHitboxes = hb->next;
-            hb = hb->next;
-            free(toFree);
         } else {
-            prevHb = hb;
-            hb = hb->next;
+            world->hitboxes[kept++] = *hb;
         }
     }
+    world->hitboxCount = kept;
     
-    trap = activeTraps;
-    while (trap != NULL) {
+    for (int i = 0; i < world->trapCount; i++) {
+        TrapNode *trap = &world->traps[i];
         Player *victim = trap->isPlayer1 ? p2 : p1;
         Rectangle victimBody = trap->isPlayer1 ? body2 : body1;
         if (CheckCollisionRecs(trap->area, victimBody)) {
             if ((int)trap->duration % 60 == 0) {
                 victim->currentHealth -= trap->damage;
                 if (trap->effect == EFFECT_POISON) victim->poisonTimer = 5.0f;
-                
-                if (trap->effect != EFFECT_POISON) {
-                    Vector2 spawnPos = {
-                        victimBody.x + victimBody.width / 2.0f,
-                        victimBody.y + victimBody.height / 2.0f
-                    };
-                    SpawnVfx(spawnPos, 0.0f, texHitVfx, 8, 0.04f, 1.0f);
-                    PlayHurtSound();
-                }
+                PushHit(world, victimBody, trap->isPlayer1, trap->effect, trap->moveType);
             }
         }
-        trap = trap->next;
     }
 }
 
@@ -363,47 +342,16 @@ void Combat_ApplyStatus(Player *player, float dt) {
     }
 }
 
-void Combat_Draw(Player *p1, Player *p2, Texture2D poisonTex, Texture2D dnaTex, Texture2D amoebaTex, Texture2D sporeTex) {
+void Combat_Draw(const CombatWorld *world, Texture2D poisonTex, Texture2D dnaTex, Texture2D amoebaTex) {
     int totalFrames = 6;
     float frameW = (float)poisonTex.width / totalFrames;
     float frameH = (float)poisonTex.height;
     int currentFrame = (int)(GetTime() * 10.0f) % totalFrames;
     Rectangle sourceRecPoison = { currentFrame * frameW, 0.0f, frameW, frameH };
 
-    for (TrapNode *t = activeTraps; t != NULL; t = t->next) {
-        Player *owner = t->isPlayer1 ? p1 : p2;
-        bool isSporeBurst = (owner->characterID == 0 && 
-                             t->moveType == MOVE_TYPE_TRAP && 
-                             fabs(t->damage - 5.0f) < 0.1f);
-
-        if (isSporeBurst) {
-            float maxDuration = 36.0f;
-            float progress = 1.0f - (t->duration / maxDuration); 
-            float alpha = t->duration / maxDuration; 
-            if (alpha < 0.0f) alpha = 0.0f;
-            if (alpha > 1.0f) alpha = 1.0f;
-
-            float radius = 30.0f + (progress * 80.0f);
-            
-            int numSpores = 8;
-            Vector2 center = { t->area.x + t->area.width/2.0f, t->area.y + t->area.height/2.0f };
-            
-            for (int i = 0; i < numSpores; i++) {
-                float angle = (i * (360.0f/numSpores) * DEG2RAD) + (progress * 2.0f);
-                
-                Vector2 pos = {
-                    center.x + cosf(angle) * radius,
-                    center.y + sinf(angle) * radius
-                };
-
-                Rectangle source = {0, 0, (float)sporeTex.width, (float)sporeTex.height};
-                Rectangle dest = { pos.x, pos.y, sporeTex.width * 3.0f, sporeTex.height * 3.0f };
-                Vector2 origin = { dest.width/2.0f, dest.height/2.0f };
-                
-                DrawTexturePro(sporeTex, source, dest, origin, angle * RAD2DEG, Fade(WHITE, alpha));
-            }
-            continue; 
-        }
+    for (int i = 0; i < world->trapCount; i++) {
+        const TrapNode *t = &world->traps[i];
+        if (t->hasParticleVisual) continue;
 
         if (t->effect == EFFECT_POISON || t->moveType == MOVE_TYPE_TRAP) {
             Color cloudColor;
@@ -428,7 +376,8 @@ void Combat_Draw(Player *p1, Player *p2, Texture2D poisonTex, Texture2D dnaTex,
         }
     }
 
-    for (ProjectileNode *p = activeProjectiles; p != NULL; p = p->next) {
+    for (int i = 0; i < world->projectileCount; i++) {
+        const ProjectileNode *p = &world->projectiles[i];
         Texture2D spriteToUse = {0};
         bool shouldUseSprite = false;
 
@@ -457,12 +406,24 @@ void Combat_Draw(Player *p1, Player *p2, Texture2D poisonTex, Texture2D dnaTex,
     }
 }
 
-void Combat_Cleanup(void) {
-    while (activeHitboxes) { HitboxNode *n = activeHitboxes; activeHitboxes=n->next; free(n); }
-    while (activeProjectiles) { ProjectileNode *n = activeProjectiles; activeProjectiles=n->next; free(n); }
-    while (activeTraps) { TrapNode *n = activeTraps; activeTraps=n->next; free(n); }
+void Combat_Cleanup(CombatWorld *world) {
+    world->hitboxCount = 0;
+    world->projectileCount = 0;
+    world->trapCount = 0;
+}
+
+void Combat_Init(CombatWorld *world) {
+    Combat_Cleanup(world);
+    world->isRecordingEvents = true;
 }
 
-void Combat_Init(void) {
-    Combat_Cleanup();
+// Só as entradas em uso são copiadas; o clone nasce sem registrar eventos
+void Combat_Clone(CombatWorld *dst, const CombatWorld *src) {
+    dst->hitboxCount = src->hitboxCount;
+    dst->projectileCount = src->projectileCount;
+    dst->trapCount = src->trapCount;
+    memcpy(dst->hitboxes, src->hitboxes, src->hitboxCount * sizeof(HitboxNode));
+    memcpy(dst->projectiles, src->projectiles, src->projectileCount * sizeof(ProjectileNode));
+    memcpy(dst->traps, src->traps, src->trapCount * sizeof(TrapNode));
+    dst->isRecordingEvents = false;
 }
\ No newline at end of file
@@ -1,11 +1,50 @@
 #include "custom_fonts.h"
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include "raylib.h"
-
-Font LoadGameFont(const char* fileName) {
-    Texture2D fontTexture = LoadTexture(fileName);
-
+#include "rlgl.h"
+
+#define FONT_TABLE_SLOTS 4
+#define TEXT_CACHE_SIZE 128
+#define TEXT_CACHE_PROBE 4
+#define TEXT_CACHE_MAX_LEN 256
+#define TEXT_LINE_SPACING 2
+
+// Tabela direta codepoint -> glyph (as fontes bitmap só têm Latin-1)
+typedef struct {
+    unsigned int textureId;
+    int index[256];
+    int fallback;
+} GlyphTable;
+
+// Em unidades da fonte: a escala e o spacing entram só na hora de desenhar
+typedef struct {
+    Rectangle dest;
+    float u0, v0, u1, v1;
+    int column;
+    int line;
+} GlyphQuad;
+
+typedef struct {
+    bool used;
+    unsigned int hash;
+    unsigned int textureId;
+    char text[TEXT_CACHE_MAX_LEN];
+    TextMetrics metrics;
+    GlyphQuad *quads;
+    int quadCount;
+    unsigned int lastUsed;
+} TextLayout;
+
+static GlyphTable glyphTables[FONT_TABLE_SLOTS];
+static int glyphTableCount = 0;
+static TextLayout textCache[TEXT_CACHE_SIZE];
+static unsigned int textCacheClock = 0;
+
+static void RegisterGlyphTable(Font font);
+
+Font LoadGameFont(Texture2D fontTexture) {
     SetTextureFilter(fontTexture, TEXTURE_FILTER_POINT);
 
     Font font = { 0 };
@@ -78,12 +117,12 @@ Font LoadGameFont(const char* fileName) {
     font.glyphs[spaceIndex].offsetY = 0;
     font.glyphs[spaceIndex].advanceX = 12;
 
+    RegisterGlyphTable(font);
+
     return font;
 }
 
-Font LoadMainFont(const char* fileName) {
-    Texture2D fontTexture = LoadTexture(fileName);
-
+Font LoadMainFont(Texture2D fontTexture) {
     SetTextureFilter(fontTexture, TEXTURE_FILTER_POINT);
 
     Font font = { 0 };
@@ -223,5 +262,238 @@ Font LoadMainFont(const char* fileName) {
         currentX += width + pngGap; 
     }
 
+    RegisterGlyphTable(font);
+
     return font;
-}
\ No newline at end of file
+}
+
+static void RegisterGlyphTable(Font font) {
+    if (glyphTableCount >= FONT_TABLE_SLOTS) {
+        printf("FONTES: Limite de tabelas de glyphs atingido\n");
+        return;
+    }
+
+    GlyphTable *table = &glyphTables[glyphTableCount++];
+    table->textureId = font.texture.id;
+    table->fallback = 0;
+
+    for (int c = 0; c < 256; c++) table->index[c] = -1;
+
+    for (int i = 0; i < font.glyphCount; i++) {
+        int value = font.glyphs[i].value;
+        if (value == '?') table->fallback = i;
+        if (value >= 0 && value < 256 && table->index[value] < 0) table->index[value] = i;
+    }
+
+    // Mesmo comportamento do GetGlyphIndex: o que não existe vira '?'
+    for (int c = 0; c < 256; c++) {
+        if (table->index[c] < 0) table->index[c] = table->fallback;
+    }
+}
+
+static const GlyphTable *FindGlyphTable(Font font) {
+    for (int i = 0; i < glyphTableCount; i++) {
+        if (glyphTables[i].textureId == font.texture.id) return &glyphTables[i];
+    }
+    return NULL;
+}
+
+static unsigned int HashText(const char *text, unsigned int textureId) {
+    unsigned int hash = 2166136261u;
+
+    for (const unsigned char *c = (const unsigned char *)text; *c != '\0'; c++) {
+        hash = (hash ^ *c) * 16777619u;
+    }
+    return (hash ^ textureId) * 16777619u;
+}
+
+// Monta os quads e a medida de uma vez, seguindo as regras do DrawTextEx/MeasureTextEx
+static void BuildTextLayout(TextLayout *layout, const GlyphTable *table, Font font, const char *text) {
+    float penX = 0.0f;
+    float lineWidth = 0.0f;
+    int line = 0;
+    int lineChars = 0;
+
+    layout->metrics = (TextMetrics){ 0.0f, 0, 1 };
+    layout->quads = (GlyphQuad *)malloc(strlen(text) * sizeof(GlyphQuad));
+    layout->quadCount = 0;
+
+    for (int i = 0; text[i] != '\0';) {
+        int bytes = 0;
+        int codepoint = GetCodepointNext(&text[i], &bytes);
+        int index = (codepoint >= 0 && codepoint < 256) ? table->index[codepoint] : table->fallback;
+        i += bytes;
+
+        if (codepoint == '\n') {
+            if (lineWidth > layout->metrics.maxLineAdvance) layout->metrics.maxLineAdvance = lineWidth;
+            lineWidth = 0.0f;
+            lineChars = 0;
+            penX = 0.0f;
+            line++;
+            layout->metrics.lineCount++;
+            continue;
+        }
+
+        GlyphInfo glyph = font.glyphs[index];
+        Rectangle rec = font.recs[index];
+
+        if (codepoint != ' ' && codepoint != '\t') {
+            GlyphQuad *quad = &layout->quads[layout->quadCount++];
+            quad->dest = (Rectangle){ penX + glyph.offsetX, (float)glyph.offsetY, rec.width, rec.height };
+            quad->u0 = rec.x / font.texture.width;
+            quad->v0 = rec.y / font.texture.height;
+            quad->u1 = (rec.x + rec.width) / font.texture.width;
+            quad->v1 = (rec.y + rec.height) / font.texture.height;
+            quad->column = lineChars;
+            quad->line = line;
+        }
+
+        penX += (glyph.advanceX == 0) ? rec.width : glyph.advanceX;
+        lineWidth += (glyph.advanceX == 0) ? (rec.width + glyph.offsetX) : glyph.advanceX;
+
+        lineChars++;
+        if (lineChars > layout->metrics.maxLineChars) layout->metrics.maxLineChars = lineChars;
+    }
+
+    if (lineWidth > layout->metrics.maxLineAdvance) layout->metrics.maxLineAdvance = lineWidth;
+}
+
+// O layout não depende do tamanho, então rótulos animados reaproveitam a mesma entrada
+static TextLayout *GetTextLayout(Font font, const char *text) {
+    const GlyphTable *table = FindGlyphTable(font);
+    if (table == NULL || strlen(text) >= TEXT_CACHE_MAX_LEN) return NULL;
+
+    unsigned int hash = HashText(text, font.texture.id);
+    int base = hash % TEXT_CACHE_SIZE;
+    TextLayout *victim = NULL;
+
+    for (int p = 0; p < TEXT_CACHE_PROBE; p++) {
+        TextLayout *slot = &textCache[(base + p) % TEXT_CACHE_SIZE];
+
+        if (slot->used && slot->hash == hash && slot->textureId == font.texture.id && strcmp(slot->text, text) == 0) {
+            slot->lastUsed = ++textCacheClock;
+            return slot;
+        }
+
+        if (victim == NULL || (victim->used && (!slot->used || slot->lastUsed < victim->lastUsed))) {
+            victim = slot;
+        }
+    }
+
+    free(victim->quads);
+    victim->used = true;
+    victim->hash = hash;
+    victim->textureId = font.texture.id;
+    strcpy(victim->text, text);
+    victim->lastUsed = ++textCacheClock;
+    BuildTextLayout(victim, table, font, text);
+
+    return victim;
+}
+
+Vector2 MeasureTextCached(Font font, const char *text, float fontSize, float spacing) {
+    if (text == NULL || text[0] == '\0') return (Vector2){ 0.0f, 0.0f };
+
+    TextLayout *layout = GetTextLayout(font, text);
+    if (layout == NULL) return MeasureTextEx(font, text, fontSize, spacing);
+
+    return ScaleTextMetrics(layout->metrics, font, fontSize, spacing);
+}
+
+void DrawTextCached(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint) {
+    if (text == NULL || text[0] == '\0') return;
+
+    TextLayout *layout = GetTextLayout(font, text);
+    if (layout == NULL) {
+        DrawTextEx(font, text, position, fontSize, spacing, tint);
+        return;
+    }
+
+    float scale = fontSize / font.baseSize;
+
+    rlCheckRenderBatchLimit(4 * layout->quadCount);
+    rlSetTexture(font.texture.id);
+    rlBegin(RL_QUADS);
+        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+
+        for (int i = 0; i < layout->quadCount; i++) {
+            const GlyphQuad *q = &layout->quads[i];
+            float x = position.x + q->dest.x * scale + q->column * spacing;
+            float y = position.y + q->dest.y * scale + q->line * (fontSize + TEXT_LINE_SPACING);
+            float w = q->dest.width * scale;
+            float h = q->dest.height * scale;
+
+            rlTexCoord2f(q->u0, q->v0); rlVertex2f(x, y);
+            rlTexCoord2f(q->u0, q->v1); rlVertex2f(x, y + h);
+            rlTexCoord2f(q->u1, q->v1); rlVertex2f(x + w, y + h);
+            rlTexCoord2f(q->u1, q->v0); rlVertex2f(x + w, y);
+        }
+    rlEnd();
+    rlSetTexture(0);
+}
+
+TextMetrics MeasureTextMetrics(Font font, const char *text) {
+    TextMetrics metrics = { 0.0f, 0, 0 };
+    if (text == NULL || text[0] == '\0') return metrics;
+
+    const GlyphTable *table = FindGlyphTable(font);
+    float lineAdvance = 0.0f;
+    int lineChars = 0;
+    metrics.lineCount = 1;
+
+    for (int i = 0; text[i] != '\0';) {
+        int bytes = 0;
+        int codepoint = GetCodepointNext(&text[i], &bytes);
+        i += bytes;
+
+        if (codepoint == '\n') {
+            if (lineAdvance > metrics.maxLineAdvance) metrics.maxLineAdvance = lineAdvance;
+            lineAdvance = 0.0f;
+            lineChars = 0;
+            metrics.lineCount++;
+            continue;
+        }
+
+        int index;
+        if (table != NULL) index = (codepoint >= 0 && codepoint < 256) ? table->index[codepoint] : table->fallback;
+        else index = GetGlyphIndex(font, codepoint);
+
+        GlyphInfo glyph = font.glyphs[index];
+        lineAdvance += (glyph.advanceX == 0) ? (font.recs[index].width + glyph.offsetX) : glyph.advanceX;
+
+        lineChars++;
+        if (lineChars > metrics.maxLineChars) metrics.maxLineChars = lineChars;
+    }
+
+    if (lineAdvance > metrics.maxLineAdvance) metrics.maxLineAdvance = lineAdvance;
+    return metrics;
+}
+
+Vector2 ScaleTextMetrics(TextMetrics metrics, Font font, float fontSize, float spacing) {
+    if (metrics.lineCount == 0) return (Vector2){ 0.0f, 0.0f };
+
+    float scale = fontSize / font.baseSize;
+    return (Vector2){
+        metrics.maxLineAdvance * scale + (metrics.maxLineChars - 1) * spacing,
+        fontSize + (metrics.lineCount - 1) * (fontSize + TEXT_LINE_SPACING)
+    };
+}
+
+void UnloadCustomFont(Font font) {
+    for (int i = 0; i < TEXT_CACHE_SIZE; i++) {
+        if (textCache[i].used && textCache[i].textureId == font.texture.id) {
+            free(textCache[i].quads);
+            textCache[i].quads = NULL;
+            textCache[i].used = false;
+        }
+    }
+
+    for (int i = 0; i < glyphTableCount; i++) {
+        if (glyphTables[i].textureId == font.texture.id) {
+            glyphTables[i] = glyphTables[--glyphTableCount];
+            break;
+        }
+    }
+
+    UnloadFont(font);
+}
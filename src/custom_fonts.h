@@ -3,7 +3,22 @@
 
 #include "raylib.h"
 
-Font LoadGameFont(const char* fileName);
-Font LoadMainFont(const char* fileName);
+// Medida de um texto independente do tamanho, em unidades da fonte
+typedef struct {
+    float maxLineAdvance;
+    int maxLineChars;
+    int lineCount;
+} TextMetrics;
+
+// A textura (já carregada) passa a pertencer à fonte
+Font LoadGameFont(Texture2D fontTexture);
+Font LoadMainFont(Texture2D fontTexture);
+void UnloadCustomFont(Font font);
+
+Vector2 MeasureTextCached(Font font, const char *text, float fontSize, float spacing);
+void DrawTextCached(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint);
+
+TextMetrics MeasureTextMetrics(Font font, const char *text);
+Vector2 ScaleTextMetrics(TextMetrics metrics, Font font, float fontSize, float spacing);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,12 @@
+#ifndef EMBEDDED_MOVESETS_H
+#define EMBEDDED_MOVESETS_H
+
+#include "game_scene.h"
+
+// --- PROTÓTIPOS DE FUNÇÕES ---
+
+// Definido no arquivo gerado por tools/movesetgen (build com MM_EMBED_MOVESETS).
+// Busca pelo caminho do JSON de origem; NULL se o moveset não foi embutido.
+const Moveset *EmbeddedMoveset_Find(const char *fileName);
+
+#endif
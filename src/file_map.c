@@ -0,0 +1,78 @@
+#include "file_map.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+bool FileMap_Open(MappedFile *map, const char *path) {
+    *map = (MappedFile){ 0 };
+
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL) {
+        CloseHandle(file);
+        return false;
+    }
+
+    const void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == NULL) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    map->data = (const unsigned char *)view;
+    map->size = (size_t)size.QuadPart;
+    map->handle = file;
+    map->mapping = mapping;
+    return true;
+}
+
+void FileMap_Close(MappedFile *map) {
+    if (map->data != NULL) UnmapViewOfFile(map->data);
+    if (map->mapping != NULL) CloseHandle((HANDLE)map->mapping);
+    if (map->handle != NULL) CloseHandle((HANDLE)map->handle);
+    *map = (MappedFile){ 0 };
+}
+
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+bool FileMap_Open(MappedFile *map, const char *path) {
+    *map = (MappedFile){ 0 };
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        close(fd);
+        return false;
+    }
+
+    void *view = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // O mapeamento continua válido depois de fechar o descritor
+    close(fd);
+    if (view == MAP_FAILED) return false;
+
+    map->data = (const unsigned char *)view;
+    map->size = (size_t)info.st_size;
+    return true;
+}
+
+void FileMap_Close(MappedFile *map) {
+    if (map->data != NULL) munmap((void *)map->data, map->size);
+    *map = (MappedFile){ 0 };
+}
+#endif
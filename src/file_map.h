@@ -0,0 +1,20 @@
+#ifndef FILE_MAP_H
+#define FILE_MAP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Mapeamento somente leitura de um arquivo inteiro. Fica fora do asset_loader
+// porque windows.h não convive com raylib.h na mesma unidade de compilação.
+typedef struct {
+    const unsigned char *data;
+    size_t size;
+    void *handle;
+    void *mapping;
+} MappedFile;
+
+// --- PROTÓTIPOS DE FUNÇÕES ---
+bool FileMap_Open(MappedFile *map, const char *path);
+void FileMap_Close(MappedFile *map);
+
+#endif
@@ -0,0 +1,145 @@
+#include "frame_pacing.h"
+#include "rlgl.h"
+#include <math.h>
+#include <stdio.h>
+
+// Folga entre o fim do trabalho estimado e o vblank no modo de baixa latência
+#define LOW_LATENCY_MARGIN 0.002
+// Diferença máxima do período de vsync para o tick ser tratado como exato
+#define VSYNC_SNAP_TOLERANCE 0.002
+
+static const char *presentModeNames[PRESENT_MODE_COUNT] = { "VSYNC", "UNCAPPED", "LOW LATENCY" };
+
+void FramePacing_Init(FramePacer *pacer, PresentMode mode) {
+    pacer->tickAccumulator = 0.0;
+    pacer->frameTime = SIM_TICK_TIME;
+    pacer->frameStartTime = GetTime();
+    pacer->lastSampleTime = pacer->frameStartTime;
+    pacer->lastPresentTime = pacer->frameStartTime;
+    pacer->sampledThisFrame = false;
+    pacer->workEstimate = 0.004f;
+
+    pacer->latencyIndex = 0;
+    pacer->latencyCount = 0;
+    pacer->averageLatencyMs = 0.0f;
+    pacer->maxLatencyMs = 0.0f;
+
+    FramePacing_SetMode(pacer, mode);
+}
+
+void FramePacing_SetMode(FramePacer *pacer, PresentMode mode) {
+    pacer->mode = mode;
+
+    int refreshRate = GetMonitorRefreshRate(GetCurrentMonitor());
+    pacer->refreshPeriod = (refreshRate > 0) ? 1.0 / refreshRate : SIM_TICK_TIME;
+
+    // O ritmo é controlado aqui, nunca pelo sleep interno do EndDrawing
+    SetTargetFPS(0);
+
+    if (mode == PRESENT_UNCAPPED) ClearWindowState(FLAG_VSYNC_HINT);
+    else SetWindowState(FLAG_VSYNC_HINT);
+
+    pacer->latencyIndex = 0;
+    pacer->latencyCount = 0;
+
+    printf("PACING: Modo %s (monitor %d Hz)\n", presentModeNames[mode], refreshRate);
+}
+
+// Retorna quantos ticks de simulação devem rodar neste frame
+int FramePacing_BeginFrame(FramePacer *pacer) {
+    if (pacer->mode == PRESENT_LOW_LATENCY) {
+        // O swap com vsync retorna no vblank: dorme até o último instante que
+        // ainda permite ler a entrada, simular e desenhar antes do próximo.
+        double deadline = pacer->lastPresentTime + pacer->refreshPeriod - pacer->workEstimate - LOW_LATENCY_MARGIN;
+        double now = GetTime();
+        if (deadline > now) WaitTime(deadline - now);
+    }
+
+    double now = GetTime();
+    double elapsed = now - pacer->frameStartTime;
+    pacer->frameStartTime = now;
+    pacer->frameTime = (float)elapsed;
+    pacer->sampledThisFrame = false;
+
+    // Depois de carregamentos longos, retoma sem tentar recuperar o tempo perdido
+    if (elapsed > SIM_TICK_TIME * PACING_MAX_TICKS_PER_FRAME) elapsed = SIM_TICK_TIME;
+
+    // Com vsync em 60 Hz o jitter do relógio não pode gerar frames com 0 ou 2 ticks
+    if (pacer->mode != PRESENT_UNCAPPED && fabs(elapsed - SIM_TICK_TIME) < VSYNC_SNAP_TOLERANCE) {
+        elapsed = SIM_TICK_TIME;
+    }
+
+    pacer->tickAccumulator += elapsed;
+
+    int ticks = 0;
+    while (pacer->tickAccumulator >= SIM_TICK_TIME && ticks < PACING_MAX_TICKS_PER_FRAME) {
+        pacer->tickAccumulator -= SIM_TICK_TIME;
+        ticks++;
+    }
+    if (pacer->tickAccumulator >= SIM_TICK_TIME) pacer->tickAccumulator = 0.0;
+
+    return ticks;
+}
+
+// Lê os eventos de entrada uma vez por tick, assim nenhum IsKeyPressed se perde
+// entre frames que não simulam (modo sem limite).
+void FramePacing_SampleInput(FramePacer *pacer) {
+    PollInputEvents();
+    pacer->lastSampleTime = GetTime();
+    pacer->sampledThisFrame = true;
+}
+
+void FramePacing_Present(FramePacer *pacer) {
+    double submitTime = GetTime();
+
+    rlDrawRenderBatchActive();
+    SwapScreenBuffer();
+
+    pacer->lastPresentTime = GetTime();
+
+    // Estimativa do custo do frame: sobe na hora, desce devagar
+    float work = (float)(submitTime - pacer->frameStartTime);
+    if (work > pacer->workEstimate) pacer->workEstimate = work;
+    else pacer->workEstimate += (work - pacer->workEstimate) * 0.05f;
+    if (pacer->workEstimate > pacer->refreshPeriod) pacer->workEstimate = (float)pacer->refreshPeriod;
+
+    if (!pacer->sampledThisFrame) return;
+
+    // Latência da entrada: da leitura dos eventos até o retorno do swap
+    float latencyMs = (float)((pacer->lastPresentTime - pacer->lastSampleTime) * 1000.0);
+    pacer->latencies[pacer->latencyIndex] = latencyMs;
+    pacer->latencyIndex = (pacer->latencyIndex + 1) % PACING_LATENCY_HISTORY;
+    if (pacer->latencyCount < PACING_LATENCY_HISTORY) pacer->latencyCount++;
+
+    float sum = 0.0f;
+    pacer->maxLatencyMs = 0.0f;
+    for (int i = 0; i < pacer->latencyCount; i++) {
+        sum += pacer->latencies[i];
+        if (pacer->latencies[i] > pacer->maxLatencyMs) pacer->maxLatencyMs = pacer->latencies[i];
+    }
+    pacer->averageLatencyMs = sum / pacer->latencyCount;
+}
+
+// Frame sem desenho nem swap: dorme até o próximo tick em vez de girar o loop
+void FramePacing_Idle(FramePacer *pacer) {
+    double nextTick = pacer->frameStartTime + (SIM_TICK_TIME - pacer->tickAccumulator);
+    double now = GetTime();
+
+    if (nextTick > now) WaitTime(nextTick - now);
+
+    // Sem swap não há vblank de referência: posiciona o prazo do modo de
+    // baixa latência exatamente neste tick para o BeginFrame não dormir de novo
+    pacer->lastPresentTime = nextTick - pacer->refreshPeriod + pacer->workEstimate + LOW_LATENCY_MARGIN;
+}
+
+float FramePacing_GetFrameTime(const FramePacer *pacer) {
+    return pacer->frameTime;
+}
+
+void FramePacing_DrawOverlay(const FramePacer *pacer, int posX, int posY) {
+    const char *text = TextFormat("%s  INPUT %4.1f ms (MAX %4.1f)  FRAME %4.1f ms",
+        presentModeNames[pacer->mode], pacer->averageLatencyMs, pacer->maxLatencyMs, pacer->frameTime * 1000.0f);
+
+    DrawRectangle(posX - 6, posY - 4, MeasureText(text, 20) + 12, 28, (Color){ 0, 0, 0, 180 });
+    DrawText(text, posX, posY, 20, (pacer->averageLatencyMs < 1000.0f / 60.0f) ? LIME : ORANGE);
+}
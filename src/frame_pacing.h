@@ -0,0 +1,41 @@
+#ifndef FRAME_PACING_H
+#define FRAME_PACING_H
+
+#include "raylib.h"
+#include "game_scene.h"
+
+#define PACING_MAX_TICKS_PER_FRAME 4
+#define PACING_LATENCY_HISTORY 60
+
+// Substitui o SetTargetFPS/EndDrawing: decide quando a entrada é lida,
+// quantos ticks fixos de simulação rodam e quando o frame é apresentado.
+typedef struct {
+    PresentMode mode;
+    double refreshPeriod;
+
+    double frameStartTime;
+    double tickAccumulator;
+    float frameTime;
+
+    double lastSampleTime;
+    double lastPresentTime;
+    bool sampledThisFrame;
+    float workEstimate;
+
+    float latencies[PACING_LATENCY_HISTORY];
+    int latencyIndex;
+    int latencyCount;
+    float averageLatencyMs;
+    float maxLatencyMs;
+} FramePacer;
+
+void FramePacing_Init(FramePacer *pacer, PresentMode mode);
+void FramePacing_SetMode(FramePacer *pacer, PresentMode mode);
+int FramePacing_BeginFrame(FramePacer *pacer);
+void FramePacing_SampleInput(FramePacer *pacer);
+void FramePacing_Present(FramePacer *pacer);
+void FramePacing_Idle(FramePacer *pacer);
+float FramePacing_GetFrameTime(const FramePacer *pacer);
+void FramePacing_DrawOverlay(const FramePacer *pacer, int posX, int posY);
+
+#endif
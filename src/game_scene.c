@@ -1,10 +1,23 @@
 #include "game_scene.h"
+#include "character_registry.h"
+#include "input_buffer.h"
+#include "custom_fonts.h"
+#include "localization.h"
+#include "particles.h"
+#include "resource_set.h"
+#include "texture_stream.h"
+#include "sound_pool.h"
 #include "raymath.h"
 #include <stdio.h>
 #include <stdlib.h>
 
 #define PLAYER_HALF_WIDTH 20
 #define PLAYER_HEIGHT 60
+#define HURT_SOUND_INSTANCES 3
+
+#define AI_LOOKAHEAD_FRAMES 36      // quanto a CPU simula à frente por opção
+#define AI_REPLAN_INTERVAL 6        // ticks mantendo um plano antes de buscar de novo
+#define AI_PREFERRED_RANGE 60.0f    // alcance dos golpes corpo a corpo
 
 typedef enum {
     SCENE_STATE_START,
@@ -14,45 +27,38 @@ typedef enum {
     SCENE_STATE_GAME_OVER
 } InternalSceneState;
 
-typedef struct VfxNode {
-    Vector2 position;
-    float rotation;
-    int frameWidth;
-    int frameHeight;
-    int currentFrame;
-    int totalFrames;
-    float animTimer;
-    float animSpeed;
-    Texture2D texture;
-    float scale;
-    struct VfxNode *next;
-} VfxNode;
-
 static Font hudFont;
 static Font mainFont;
-static Texture2D texRocketVfx;
-static VfxNode *activeVfx = NULL;
 static bool isMultiplayerMode = false;
 static Player *player1;
 static Player *player2;
+static PlayerVisual visuals[2];         // [0] = P1, [1] = P2
 static InternalSceneState sceneState;
 static int countdownTimer = 0;
 static int matchWinner = 0;
 static int fightBannerTimer = 0;
-static int currentLanguage = 0;
 static int pauseOption = 0;
-const char* pauseOptionsText[] = { "RESUME", "SETTINGS", "QUIT MATCH" };
+static unsigned int simTick = 0;
+static unsigned int presentedTick = 0;
+static int inputBufferWindow = INPUT_BUFFER_DEFAULT;
+static PlayerInput p1Input;
+static PlayerInput p2Input;
+static PlayerInput cpuInput;
+static const InputConfig p1Controls = { KEY_A, KEY_D, KEY_W, KEY_S, KEY_SPACE, KEY_J, KEY_K };
+static const InputConfig p2Controls = { KEY_LEFT, KEY_RIGHT, KEY_UP, KEY_DOWN, KEY_KP_0, KEY_KP_1, KEY_KP_2 };
+static const InputConfig cpuControls = { 0 };      // não lê teclado: ThinkAI alimenta
+static CombatWorld combatWorld;
+static SpriteAtlas characterSprites[2];
 static Texture2D texBackground;
 static Texture2D texPoisonCloud;
-static Texture2D texExplosion;
-static Texture2D texBactIcon;
-static Texture2D texAmoebaIcon;
+static Texture2D texCharacterIcons[CHARACTER_COUNT];
 static Texture2D texDNAProjectile;
 static Texture2D texAmoebaProjectile;
-static Texture2D texSpore;
-Texture2D texHitVfx;
-static Sound sndHurt1;
-static Sound sndHurt2;
+static int fxHitSpark = -1;
+static int fxSporeBurst = -1;
+static int fxRocketTrail = -1;
+static int fxExplosion = -1;
+static int sndHurt = SOUND_NONE;
 
 static Texture2D texGuiFrame;
 static Texture2D texSyringeEmptyL, texSyringeFullL;
@@ -61,111 +67,51 @@ static Texture2D texPillEmptyL, texPillFullL;
 static Texture2D texPillEmptyR, texPillFullR;
 static Texture2D texTabletActive, texTabletInactive;
 
-static const char* GetCharacterJSON(int charID) {
-    switch(charID) {
-        case 0: return "assets/data/bacteriophage.json";
-        case 1: return "assets/data/amoeba.json";
-        default: return "assets/data/bacteriophage.json";
-    }
-}
-
-static const char* GetCharacterName(int charID) {
-    if (currentLanguage == 1) {
-        switch(charID) {
-            case 0: return "BACTERIOFAGO";
-            case 1: return "AMEBA";
-            default: return "DESCONHECIDO";
-        }
-    } 
-    else {
-        switch(charID) {
-            case 0: return "BACTERIOPHAGE";
-            case 1: return "AMOEBA";
-            default: return "UNKNOWN";
-        }
-    }
-}
+// Texturas que não dependem dos personagens: dá para pré-carregar na seleção
+static ResourceSet matchResources = { .name = "match" };
+static bool isMatchLoaded = false;
 
-void SpawnVfx(Vector2 pos, float rotation, Texture2D tex, int frames, float speed, float scale) {
-    VfxNode *newNode = (VfxNode*)malloc(sizeof(VfxNode));
-    if (!newNode) return;
-
-    newNode->position = pos;
-    newNode->rotation = rotation;
-    newNode->texture = tex;
-    newNode->totalFrames = frames; 
-    newNode->frameWidth = tex.width / frames;
-    newNode->frameHeight = tex.height;
-    newNode->currentFrame = 0;
-    newNode->animTimer = 0.0f;
-    newNode->animSpeed = speed; 
-    newNode->scale = scale;
-
-    newNode->next = activeVfx;
-    activeVfx = newNode;
+// Prefere o atlas recortado gerado pelo spritepack no build; a folha original é o fallback
+static void LoadCharacterSprites(SpriteAtlas *atlas, const CharacterDef *character) {
+    SpriteAtlas_Load(atlas, character->atlasFile, character->sheetFile, character->frameWidth, character->frameHeight);
 }
 
-static void UpdateVfx(float dt) {
-    VfxNode *current = activeVfx;
-    VfxNode *prev = NULL;
+// Entra no frame 0 do golpe
+static void StartMove(Player *player, const Move *move, bool isP1, CombatWorld *world) {
+    player->state = PLAYER_STATE_ATTACK;
+    player->attackFrameCounter = 0;
+    player->currentMove = move;
+    player->isSteering = false;
 
-    while (current != NULL) {
-        current->animTimer += dt;
-        if (current->animTimer >= current->animSpeed) {
-            current->animTimer = 0.0f;
-            current->currentFrame++;
-        }
+    if (player->character->hooks.onMoveStart) player->character->hooks.onMoveStart(player, move);
 
-        if (current->currentFrame >= current->totalFrames) {
-            VfxNode *toFree = current;
-            if (prev) prev->next = current->next;
-            else activeVfx = current->next;
-            current = current->next;
-            free(toFree);
-        } else {
-            prev = current;
-            current = current->next;
-        }
+    if (move->frameCount > 0 && (move->timeline[0] & MOVE_FRAME_SPAWN)) {
+        Combat_TryExecuteMove(world, player, move, isP1);
     }
 }
 
-static void DrawVfx(void) {
-    for (VfxNode *vfx = activeVfx; vfx != NULL; vfx = vfx->next) {
-        if (vfx->texture.id == 0) continue;
-
-        int frameX = vfx->currentFrame; 
-
-        Rectangle sourceRec = {
-            (float)frameX * vfx->frameWidth,
-            0.0f,
-            (float)vfx->frameWidth,
-            (float)vfx->frameHeight
-        };
-
-        Rectangle destRec = {
-            vfx->position.x,
-            vfx->position.y,
-            vfx->frameWidth * vfx->scale,
-            vfx->frameHeight * vfx->scale
-        };
-
-        Vector2 origin = { destRec.width / 2.0f, destRec.height / 2.0f };
-
-        DrawTexturePro(vfx->texture, sourceRec, destRec, origin, vfx->rotation, WHITE);
-    }
-}
+static void EmitRocketTrail(CombatWorld *world, const Player *player, unsigned int flags) {
+    Vector2 spawnPos = player->position;
+    float rotation = 0.0f;
 
-static void Vfx_Cleanup(void) {
-    while (activeVfx) {
-        VfxNode *n = activeVfx;
-        activeVfx = n->next;
-        free(n);
+    if (flags & MOVE_FRAME_TRAIL_SIDE) {
+        spawnPos.x += player->isFlipped ? 40 : -40;
+        spawnPos.y -= 30; 
+        rotation = player->isFlipped ? -90.0f : 90.0f;
+    } else if (flags & MOVE_FRAME_TRAIL_DOWN) {
+        spawnPos.y -= 70;
+        rotation = 180.0f;
+    } else {
+        spawnPos.y += 20;
     }
+    Combat_EmitEffect(world, COMBAT_EVENT_ROCKET_TRAIL, spawnPos, rotation);
 }
 
-static void UpdateHuman(Player *player, float dt, InputConfig input) {
-    Combat_ApplyStatus(player, dt);
-    bool isP1 = (player == player1);
+// Física e regras de golpe de um jogador, iguais para humano e CPU: só
+// muda quem preenche o PlayerInput. Não lê nem escreve estado global, então
+// roda igual sobre cópias (busca da CPU).
+static void Player_Step(Player *player, bool isP1, PlayerInput *input, CombatWorld *world, unsigned int tick) {
+    Combat_ApplyStatus(player, SIM_TICK_TIME);
 
     if (player->state == PLAYER_STATE_HURT) {
         player->velocity.x *= 0.90f;
@@ -182,104 +128,68 @@ static void UpdateHuman(Player *player, float dt, InputConfig input) {
     if (player->state == PLAYER_STATE_ATTACK) {
         player->attackFrameCounter++;
         
-        Move *move = (player->currentMove != NULL) ? player->currentMove : &player->moves->sideGround;
+        const Move *move = (player->currentMove != NULL) ? player->currentMove : &player->moves->sideGround;
+        int frame = (player->attackFrameCounter < move->frameCount) ? player->attackFrameCounter : move->frameCount - 1;
+        unsigned int flags = (frame >= 0) ? move->timeline[frame] : MOVE_FRAME_END;
         
-        if (move->canCombo && IsKeyPressed(input.attack)) {
-            if (player->attackFrameCounter > (move->startupFrames + move->activeFrames)) {
-                player->attackFrameCounter = 0; 
-                Combat_TryExecuteMove(player, move, isP1);
-                return;
-            }
+        // O toque fica no buffer até o fim da janela ativa, em vez de exigir precisão de 1 frame
+        if ((flags & MOVE_FRAME_CANCEL) && Input_TakePress(input, BUTTON_ATTACK)) {
+            StartMove(player, move, isP1, world);
+            return;
         }
 
-        if (move->selfVelocity.x != 0 || move->selfVelocity.y != 0) {
+        if (flags & MOVE_FRAME_SELF_VELOCITY) {
             float dir = player->isFlipped ? -1.0f : 1.0f;
             player->velocity.x = move->selfVelocity.x * dir;
             player->velocity.y = move->selfVelocity.y;
         }
 
-        if (move->steerSpeed > 0) {
-            if (IsKeyDown(input.left)) {
+        player->isSteering = (flags & MOVE_FRAME_STEER) &&
+                             (Input_IsHeld(input, BUTTON_LEFT) || Input_IsHeld(input, BUTTON_RIGHT));
+
+        if (flags & MOVE_FRAME_STEER) {
+            if (Input_IsHeld(input, BUTTON_LEFT)) {
                 player->position.x -= move->steerSpeed;
-                
-                if (player->characterID == 1 && move == &player->moves->ultimate) {
-                    player->isFlipped = true;
-                }
+                if (move->steerTurns) player->isFlipped = true;
             }
-            if (IsKeyDown(input.right)) {
+            if (Input_IsHeld(input, BUTTON_RIGHT)) {
                 player->position.x += move->steerSpeed;
-                
-                if (player->characterID == 1 && move == &player->moves->ultimate) {
-                    player->isFlipped = false;
-                }
+                if (move->steerTurns) player->isFlipped = false;
             }
         }
 
-        if (player->characterID == 0) {
-            if (move == &player->moves->specialSide || 
-                move == &player->moves->specialUp || 
-                move == &player->moves->ultimate) {
-                
-                player->vfxSpawnTimer += dt;
-                if (player->vfxSpawnTimer >= 0.4f) {
-                    player->vfxSpawnTimer = 0.0f;
-                    Vector2 spawnPos = player->position;
-                    float rotation = 0.0f;
-
-                    if (move == &player->moves->specialSide) {
-                        spawnPos.x += player->isFlipped ? 40 : -40;
-                        spawnPos.y -= 30; 
-                        rotation = player->isFlipped ? -90.0f : 90.0f;
-                    } else if (move == &player->moves->specialUp) {
-                        spawnPos.y += 20; 
-                    } else if (move == &player->moves->ultimate) {
-                        if (player->velocity.y > 0) { spawnPos.y -= 70; rotation = 180.0f; }
-                        else spawnPos.y += 20;
-                    }
-                    SpawnVfx(spawnPos, rotation, texRocketVfx, 11, 0.05f, 2.5f); 
-                }
-            } else {
-                 player->vfxSpawnTimer = 0.4f;
-            }
+        if (flags & MOVE_FRAME_TRAIL) EmitRocketTrail(world, player, flags);
+
+        if (flags & MOVE_FRAME_SPAWN_CLOUD) {
+            Move cloud = {0};
+            cloud.type = MOVE_TYPE_TRAP;
+            cloud.hitbox = (Rectangle){ -300, -300, 600, 600 }; 
+            cloud.damage = 2.0f;
+            cloud.effect = EFFECT_POISON;
+            cloud.effectDuration = 5.0f;
+            cloud.trapDuration = 5.0f;
+
+            Vector2 currentPos = player->position;
+            player->position = player->ultLaunchPos;
+            Combat_TryExecuteMove(world, player, &cloud, isP1);
+            player->position = currentPos;
         }
 
-        if (move->type == MOVE_TYPE_ULTIMATE_FALL) {
-            int peakFrame = 40;
-            int hangTime = 60;
-
-            if (player->attackFrameCounter == peakFrame) {
-                Move cloud = {0};
-                cloud.type = MOVE_TYPE_TRAP;
-                cloud.hitbox = (Rectangle){ -300, -300, 600, 600 }; 
-                cloud.damage = 2.0f;
-                cloud.effect = EFFECT_POISON;
-                cloud.effectDuration = 5.0f;
-                cloud.trapDuration = 5.0f;
-
-                Vector2 currentPos = player->position;
-                player->position = player->ultLaunchPos;
-                Combat_TryExecuteMove(player, &cloud, isP1);
-                player->position = currentPos;
-            }
-
-            if (player->attackFrameCounter >= peakFrame && player->attackFrameCounter < (peakFrame + hangTime)) {
-                player->velocity.y = 0; 
-                player->velocity.x = 0;
-            }
-            else if (player->attackFrameCounter >= (peakFrame + hangTime)) {
-                player->velocity.y = move->fallSpeed;
-                if (IsKeyDown(input.left))  player->position.x -= move->steerSpeed;
-                if (IsKeyDown(input.right)) player->position.x += move->steerSpeed;
-            }
+        if (flags & MOVE_FRAME_HANG) {
+            player->velocity.y = 0; 
+            player->velocity.x = 0;
+        }
+        else if (flags & MOVE_FRAME_FALL) {
+            player->velocity.y = move->fallSpeed;
+            if (Input_IsHeld(input, BUTTON_LEFT))  player->position.x -= move->steerSpeed;
+            if (Input_IsHeld(input, BUTTON_RIGHT)) player->position.x += move->steerSpeed;
         }
 
-        if (player->characterID == 1 && move == &player->moves->ultimate) {
-             player->velocity.y += 0.5f;
-             
-             if (IsKeyPressed(input.jump) && player->isGrounded) {
-                 player->velocity.y = -12.0f;
-                 player->isGrounded = false;
-             }
+        if (flags & MOVE_FRAME_GRAVITY) player->velocity.y += 0.5f;
+
+        if ((flags & MOVE_FRAME_JUMP) && player->isGrounded && Input_TakePress(input, BUTTON_JUMP)) {
+            player->velocity.y = -12.0f;
+            player->isGrounded = false;
         }
 
         if (player->velocity.y > 30.0f) player->velocity.y = 30.0f;
@@ -303,19 +213,18 @@ static void UpdateHuman(Player *player, float dt, InputConfig input) {
         }
         
         if (player->position.y > GROUND_LEVEL) { 
-             if (move->selfVelocity.y > 0 || move->fallSpeed > 0) {
-                 
-                 if (move->type == MOVE_TYPE_ULTIMATE_FALL && player->characterID == 0) {
+             if (flags & MOVE_FRAME_LAND_END) {
+                 if (flags & MOVE_FRAME_LAND_EXPLODE) {
                      Move explosion = {0};
                      explosion.type = MOVE_TYPE_ULTIMATE; 
                      explosion.hitbox = (Rectangle){ -400, -500, 800, 600 }; 
                      explosion.damage = 40.0f;
                      explosion.knockback = (Vector2){ 25.0f, -25.0f };
                      explosion.activeFrames = 10;
-                     Combat_TryExecuteMove(player, &explosion, isP1);
+                     Combat_TryExecuteMove(world, player, &explosion, isP1);
 
                      Vector2 explosionPos = { player->position.x, GROUND_LEVEL - 30 };
-                     SpawnVfx(explosionPos, 0.0f, texExplosion, 4, 0.08f, 12.0f);
+                     Combat_EmitEffect(world, COMBAT_EVENT_EXPLOSION, explosionPos, 0.0f);
                  }
 
                  player->position.y = GROUND_LEVEL;
@@ -331,8 +240,7 @@ static void UpdateHuman(Player *player, float dt, InputConfig input) {
              player->isGrounded = true;
         }
 
-        int totalAttackFrames = move->startupFrames + move->activeFrames + move->recoveryFrames;     
-        if (player->attackFrameCounter > totalAttackFrames) {
+        if (flags & MOVE_FRAME_END) {
             if (player->isGrounded) {
                 player->state = PLAYER_STATE_IDLE;
                 player->velocity = (Vector2){0,0};
@@ -344,8 +252,6 @@ static void UpdateHuman(Player *player, float dt, InputConfig input) {
         }
         return;
     }
-    
-    player->vfxSpawnTimer = 0.4f;
 
     if (!player->isGrounded) {
         player->velocity.y += 0.5f;
@@ -387,11 +293,11 @@ static void UpdateHuman(Player *player, float dt, InputConfig input) {
 
     if (player->state != PLAYER_STATE_HURT) {
         player->velocity.x = 0;
-        if (IsKeyDown(input.left)) { 
+        if (Input_IsHeld(input, BUTTON_LEFT)) { 
             player->velocity.x = -5.0f; 
             player->isFlipped = true; 
         }
-        if (IsKeyDown(input.right)) { 
+        if (Input_IsHeld(input, BUTTON_RIGHT)) { 
             player->velocity.x = 5.0f; 
             player->isFlipped = false; 
         }
@@ -399,26 +305,25 @@ static void UpdateHuman(Player *player, float dt, InputConfig input) {
         if (player->velocity.x != 0 && player->isGrounded) player->state = PLAYER_STATE_WALK;
         else if (player->isGrounded) player->state = PLAYER_STATE_IDLE;
         
-        if (IsKeyPressed(input.jump) && player->isGrounded) {
+        if (player->isGrounded && Input_TakePress(input, BUTTON_JUMP)) {
             player->velocity.y = -12.0f;
             player->isGrounded = false;
             player->state = PLAYER_STATE_JUMP;
         }
 
-        Move *selectedMove = NULL;
+        const Move *selectedMove = NULL;
         bool isSpecial = false;
 
-        if (IsKeyPressed(input.attack) || IsKeyPressed(input.special)) {
-            isSpecial = IsKeyPressed(input.special);
+        bool specialPressed = Input_TakePress(input, BUTTON_SPECIAL);
+        bool attackPressed = Input_TakePress(input, BUTTON_ATTACK);
+
+        if (attackPressed || specialPressed) {
+            isSpecial = specialPressed;
             
             player->state = PLAYER_STATE_ATTACK;
             player->attackFrameCounter = 0;
 
-            if (player->characterID == 1) {
-                player->velocity = (Vector2){ 0, 0 };
-            }
-
-            if (IsKeyDown(input.up)) {
+            if (Input_IsHeld(input, BUTTON_UP)) {
                 if (isSpecial) {
                     if (!player->hasUsedAirSpecial || player->isGrounded) {
                         selectedMove = &player->moves->specialUp;
@@ -426,15 +331,15 @@ static void UpdateHuman(Player *player, float dt, InputConfig input) {
                 } 
                 else selectedMove = player->isGrounded ? &player->moves->upGround : &player->moves->airUp;
             }
-            else if (IsKeyDown(input.down)) {
+            else if (Input_IsHeld(input, BUTTON_DOWN)) {
                 if (isSpecial) selectedMove = &player->moves->specialDown;
                 else selectedMove = player->isGrounded ? &player->moves->downGround : &player->moves->airDown;
             }
             else {
-                bool movingSide = IsKeyDown(input.left) || IsKeyDown(input.right);
+                bool movingSide = Input_IsHeld(input, BUTTON_LEFT) || Input_IsHeld(input, BUTTON_RIGHT);
                 
-                if (IsKeyDown(input.left)) player->isFlipped = true;
-                if (IsKeyDown(input.right)) player->isFlipped = false;
+                if (Input_IsHeld(input, BUTTON_LEFT)) player->isFlipped = true;
+                if (Input_IsHeld(input, BUTTON_RIGHT)) player->isFlipped = false;
 
                 if (isSpecial) {
                     if (movingSide) {
@@ -454,14 +359,13 @@ static void UpdateHuman(Player *player, float dt, InputConfig input) {
             }
 
             if (selectedMove != NULL) {
-                if (GetTime() - selectedMove->lastUsedTime < selectedMove->cooldown) {
+                unsigned int *readyTick = &player->moveReadyTick[Character_MoveSlot(player, selectedMove)];
+                if (tick < *readyTick) {
                     player->state = PLAYER_STATE_IDLE;
                     return;
                 }
-                selectedMove->lastUsedTime = GetTime();
-                
-                Combat_TryExecuteMove(player, selectedMove, isP1);
-                player->currentMove = selectedMove;
+                *readyTick = tick + selectedMove->cooldownFrames;
+                StartMove(player, selectedMove, isP1, world);
 
                 if (selectedMove == &player->moves->specialUp && !player->isGrounded) {
                     player->hasUsedAirSpecial = true;
@@ -478,335 +382,204 @@ static void UpdateHuman(Player *player, float dt, InputConfig input) {
     }
 }
 
-static void UpdateAI(Player *ai, Player *target, float dt) {
-    Combat_ApplyStatus(ai, dt);
-
-    if (ai->state == PLAYER_STATE_HURT) {
-        ai->velocity.x *= 0.90f; 
-        
-        if (ai->attackFrameCounter > 0) {
-            ai->attackFrameCounter--;
-        } else {
-            ai->state = PLAYER_STATE_FALL;
-        }
-
-        if (fabs(ai->velocity.x) < 0.1f) ai->velocity.x = 0;
-    }
-
-    float distanceX = target->position.x - ai->position.x;
-    float distanceY = target->position.y - ai->position.y;
-    
-    bool nearLeftWall = (ai->position.x < 150.0f);
-    bool nearRightWall = (ai->position.x > GAME_WIDTH - 150.0f);
-    bool isCornered = nearLeftWall || nearRightWall;
-
-    if (target->state == PLAYER_STATE_ATTACK && ai->state != PLAYER_STATE_ATTACK) {
-        if (fabs(distanceX) < 150.0f) {
-            if (isCornered) {
-                ai->aiState = AI_STATE_ATTACK;
-                ai->aiTimer = 0;
-            } else {
-                ai->aiState = AI_STATE_FLEE;
-                ai->aiTimer = 0;
-            }
-        }
+// Um tick da luta: os dois jogadores e depois o combate. O mesmo passo
+// serve à partida e aos clones da busca da CPU.
+static void Sim_Step(Player *players[2], PlayerInput *inputs[2], CombatWorld *world, unsigned int tick) {
+    for (int i = 0; i < 2; i++) {
+        Player_Step(players[i], i == 0, inputs[i], world, tick);
+        if (players[i]->character->hooks.onTick) players[i]->character->hooks.onTick(players[i]);
     }
+    Combat_Update(world, players[0], players[1]);
+}
 
-    if (ai->state != PLAYER_STATE_ATTACK && ai->state != PLAYER_STATE_HURT) { 
-        ai->vfxSpawnTimer = 0.4f;
-
-        switch (ai->aiState) {
-            case AI_STATE_THINKING:
-                ai->velocity.x = 0;
-                ai->aiTimer++;
-                if (ai->aiTimer > 30) { 
-                    ai->aiTimer = 0;
-                    int decision = GetRandomValue(1, 100);
-                    
-                    if (isCornered && fabs(distanceX) < 200.0f) {
-                        if (ai->isGrounded) {
-                            ai->velocity.y = -12.0f;
-                            ai->isGrounded = false;
-                            ai->state = PLAYER_STATE_JUMP;
-                            ai->velocity.x = nearLeftWall ? 5.0f : -5.0f;
-                        }
-                        ai->aiState = AI_STATE_APPROACH;
-                    }
-                    else if (distanceY < -50 && fabs(distanceX) < 100) {
-                        if (ai->isGrounded) {
-                            ai->velocity.y = -12.0f;
-                            ai->isGrounded = false;
-                            ai->state = PLAYER_STATE_JUMP;
-                        } else {
-                            ai->state = PLAYER_STATE_ATTACK;
-                            ai->attackFrameCounter = 0;
-                            Combat_TryExecuteMove(ai, &ai->moves->airUp, false);
-                            ai->currentMove = &ai->moves->airUp;
-                        }
-                        ai->aiState = AI_STATE_THINKING;
-                    }
-                    else if (decision < 20 && ai->isGrounded) {
-                        ai->velocity.y = -12.0f;
-                        ai->isGrounded = false;
-                        ai->state = PLAYER_STATE_JUMP;
-                        if (distanceX > 0) ai->velocity.x = 4.0f; else ai->velocity.x = -4.0f;
-                        ai->aiState = AI_STATE_APPROACH;
-                    }
-                    else if (fabs(distanceX) < 120) { 
-                        if (decision < 80) ai->aiState = AI_STATE_ATTACK; else ai->aiState = AI_STATE_APPROACH;
-                    } 
-                    else { 
-                        if (decision < 80) ai->aiState = AI_STATE_APPROACH; else ai->aiState = AI_STATE_THINKING;
-                    }
-                }
-                break;
+// --- CPU: BUSCA COM ANTECIPAÇÃO ---
 
-            case AI_STATE_APPROACH:
-                if (distanceX > 0) { ai->velocity.x = 5.0f; ai->isFlipped = false; } 
-                else { ai->velocity.x = -5.0f; ai->isFlipped = true; }
+typedef enum {
+    AI_DIR_NONE,
+    AI_DIR_TOWARD,
+    AI_DIR_AWAY
+} AIDirection;
+
+// Uma opção da CPU: direção relativa ao alvo, botões segurados e o toque
+// do primeiro tick
+typedef struct {
+    AIDirection direction;
+    unsigned int held;
+    unsigned int tapped;
+} AIPlan;
+
+static const AIPlan aiPlans[] = {
+    { AI_DIR_NONE,   0,           0 },
+    { AI_DIR_TOWARD, 0,           0 },
+    { AI_DIR_AWAY,   0,           0 },
+    { AI_DIR_TOWARD, 0,           BUTTON_JUMP },
+    { AI_DIR_NONE,   0,           BUTTON_JUMP },
+    { AI_DIR_AWAY,   0,           BUTTON_JUMP },
+    { AI_DIR_NONE,   0,           BUTTON_ATTACK },
+    { AI_DIR_TOWARD, 0,           BUTTON_ATTACK },
+    { AI_DIR_NONE,   BUTTON_UP,   BUTTON_ATTACK },
+    { AI_DIR_NONE,   BUTTON_DOWN, BUTTON_ATTACK },
+    { AI_DIR_NONE,   0,           BUTTON_SPECIAL },     // ultimate com a barra cheia
+    { AI_DIR_TOWARD, 0,           BUTTON_SPECIAL },
+    { AI_DIR_NONE,   BUTTON_UP,   BUTTON_SPECIAL },
+    { AI_DIR_NONE,   BUTTON_DOWN, BUTTON_SPECIAL }
+};
+
+#define AI_PLAN_COUNT ((int)(sizeof(aiPlans) / sizeof(aiPlans[0])))
+
+// Respostas do oponente testadas contra cada plano; vale a pior
+static const unsigned int aiResponses[] = { 0, BUTTON_ATTACK, BUTTON_JUMP };
+
+#define AI_RESPONSE_COUNT ((int)(sizeof(aiResponses) / sizeof(aiResponses[0])))
+
+#define AI_DIRECTION_BUTTONS (BUTTON_LEFT | BUTTON_RIGHT | BUTTON_UP | BUTTON_DOWN)
+
+// Tempo de busca por tick. Orçamento curto não corta a qualidade da
+// escolha, atrasa: a busca se espalha por mais ticks e a CPU reage tarde.
+// O relógio é conferido antes de cada simulação; uma já começada vai até o fim.
+static const double cpuBudgets[CPU_DIFFICULTY_COUNT] = { 0.00002, 0.0001, 0.0005 };
+static CPUDifficulty cpuDifficulty = CPU_DIFFICULTY_NORMAL;
+
+// Busca em andamento e plano em execução; sobrevive entre ticks
+static struct {
+    int nextPlan;
+    int nextResponse;
+    float planScore;            // pior resposta do plano em avaliação
+    int bestPlan;
+    float bestScore;
+
+    int activePlan;
+    int planTicks;
+    bool pendingTap;
+
+    // Estado de partida da busca: todos os planos são pontuados a partir dele
+    Player ai;
+    Player target;
+    unsigned int tick;
+    unsigned int targetHeld;
+} cpuSearch;
+
+static CombatWorld searchWorld;
+static CombatWorld rolloutWorld;
+static PlayerInput rolloutInputs[2];
+
+void GameScene_SetCPUDifficulty(CPUDifficulty difficulty) {
+    if (difficulty < 0 || difficulty >= CPU_DIFFICULTY_COUNT) difficulty = CPU_DIFFICULTY_NORMAL;
+    cpuDifficulty = difficulty;
+}
 
-                if (!ai->isGrounded && distanceY > 0 && fabs(distanceX) < 60) {
-                    ai->state = PLAYER_STATE_ATTACK;
-                    ai->attackFrameCounter = 0;
-                    Combat_TryExecuteMove(ai, &ai->moves->airDown, false);
-                    ai->currentMove = &ai->moves->airDown;
-                    ai->aiState = AI_STATE_THINKING;
-                }
-                else if (fabs(distanceX) < 90 && ai->isGrounded) {
-                    ai->aiState = AI_STATE_ATTACK;
-                }
-                break;
+static void ResetAISearch(void) {
+    cpuSearch.nextPlan = 0;
+    cpuSearch.nextResponse = 0;
+    cpuSearch.planScore = 0.0f;
+    cpuSearch.bestPlan = 0;
+    cpuSearch.bestScore = 0.0f;
+    cpuSearch.activePlan = 0;
+    cpuSearch.planTicks = AI_REPLAN_INTERVAL;
+    cpuSearch.pendingTap = false;
+}
 
-            case AI_STATE_ATTACK:
-                {
-                    ai->state = PLAYER_STATE_ATTACK;
-                    ai->attackFrameCounter = 0;
-                    Move *move = NULL;
-                    int randAttack = GetRandomValue(0, 100);
-
-                    if (ai->currentUlt >= ai->maxUlt && randAttack < 20) {
-                        move = &ai->moves->ultimate;
-                        ai->ultLaunchPos = ai->position;
-                        ai->currentUlt = 0;
-                        ai->ultCharge = 0.0f;
-                    }
-                    else if (randAttack < 50) {
-                        int specialType = GetRandomValue(0, 3);
-                        if (specialType == 0) move = &ai->moves->specialNeutral;
-                        else if (specialType == 1) move = &ai->moves->specialSide;
-                        else if (specialType == 2) {
-                            if (!ai->hasUsedAirSpecial || ai->isGrounded) {
-                                move = &ai->moves->specialUp;
-                            } else {
-                                move = &ai->moves->airUp;
-                            }
-                        }
-                        else move = &ai->moves->specialDown;
-                    }
-                    else {
-                        int basicType = GetRandomValue(0, 2);
-                        if (basicType == 0) move = &ai->moves->sideGround;
-                        else if (basicType == 1) move = &ai->moves->upGround;
-                        else move = &ai->moves->downGround;
-                    }
-                    
-                    if (move != NULL && GetTime() - move->lastUsedTime < move->cooldown) {
-                        move = &ai->moves->sideGround;
-                    }
+// Aproximar para no alcance em vez de atravessar o alvo
+static unsigned int PlanHeld(const AIPlan *plan, const Player *ai, const Player *target) {
+    float distanceX = target->position.x - ai->position.x;
+    bool targetRight = (distanceX > 0);
+    unsigned int held = plan->held;
 
-                    if (move != NULL) {
-                        move->lastUsedTime = GetTime();
-                        Combat_TryExecuteMove(ai, move, false);
-                        ai->currentMove = move;
-                        
-                        if (move == &ai->moves->specialUp && !ai->isGrounded) {
-                            ai->hasUsedAirSpecial = true;
-                        }
-                    }
-                    
-                    ai->aiState = AI_STATE_THINKING;
-                    ai->aiTimer = 0;
-                }
-                break;
-            
-            case AI_STATE_FLEE:
-                if (isCornered) {
-                    ai->aiState = AI_STATE_ATTACK;
-                } else {
-                    ai->aiTimer++;
-                    if (distanceX > 0) { ai->velocity.x = -5.0f; ai->isFlipped = true; } 
-                    else { ai->velocity.x = 5.0f; ai->isFlipped = false; }
-                    
-                    if (ai->aiTimer > 18) {
-                        ai->aiState = AI_STATE_THINKING;
-                        ai->aiTimer = 0;
-                    }
-                }
-                break;
-        }
+    if (plan->direction == AI_DIR_TOWARD) {
+        if (fabsf(distanceX) > AI_PREFERRED_RANGE) held |= targetRight ? BUTTON_RIGHT : BUTTON_LEFT;
     }
+    else if (plan->direction == AI_DIR_AWAY) held |= targetRight ? BUTTON_LEFT : BUTTON_RIGHT;
+    return held;
+}
 
-    if (ai->state == PLAYER_STATE_ATTACK) {
-        ai->attackFrameCounter++;
-        Move *move = (ai->currentMove != NULL) ? ai->currentMove : &ai->moves->sideGround;
-        
-        if (move->selfVelocity.x != 0 || move->selfVelocity.y != 0) {
-            float dir = ai->isFlipped ? -1.0f : 1.0f;
-            ai->velocity.x = move->selfVelocity.x * dir;
-            ai->velocity.y = move->selfVelocity.y;
-        }
-
-        if (ai->characterID == 0) {
-            if (move == &ai->moves->specialSide || 
-                move == &ai->moves->specialUp || 
-                move == &ai->moves->ultimate) {
-                
-                ai->vfxSpawnTimer += dt;
-                if (ai->vfxSpawnTimer >= 0.4f) {
-                    ai->vfxSpawnTimer = 0.0f;
-                    Vector2 spawnPos = ai->position;
-                    float rotation = 0.0f;
-                    if (move == &ai->moves->specialSide) {
-                        spawnPos.x += ai->isFlipped ? 40 : -40;
-                        spawnPos.y -= 30;
-                        rotation = ai->isFlipped ? -90.0f : 90.0f;
-                    } else if (move == &ai->moves->specialUp) {
-                        spawnPos.y += 20; 
-                    } else if (move == &ai->moves->ultimate) {
-                        if (ai->velocity.y > 0) { spawnPos.y -= 70; rotation = 180.0f; }
-                        else spawnPos.y += 20;
-                    }
-                    SpawnVfx(spawnPos, rotation, texRocketVfx, 11, 0.05f, 2.5f);
-                }
-            } else {
-                 ai->vfxSpawnTimer = 0.4f;
-            }
-        }
-
-        if (move->type == MOVE_TYPE_ULTIMATE_FALL) {
-            int peakFrame = 40;
-            int hangTime = 60;
-
-            if (ai->attackFrameCounter == peakFrame) {
-                Move cloud = {0};
-                cloud.type = MOVE_TYPE_TRAP;
-                cloud.hitbox = (Rectangle){ -300, -300, 600, 600 }; 
-                cloud.damage = 2.0f;
-                cloud.effect = EFFECT_POISON;
-                cloud.effectDuration = 5.0f;
-                cloud.trapDuration = 5.0f;
-
-                Vector2 currentPos = ai->position;
-                ai->position = ai->ultLaunchPos;
-                Combat_TryExecuteMove(ai, &cloud, false);
-                ai->position = currentPos;
-            }
-
-            if (ai->attackFrameCounter >= peakFrame && ai->attackFrameCounter < (peakFrame + hangTime)) {
-                ai->velocity.y = 0; 
-                ai->velocity.x = 0;
-            }
-            else if (ai->attackFrameCounter >= (peakFrame + hangTime)) {
-                ai->velocity.y = move->fallSpeed;
-            }
-        }
-
-        if (ai->characterID == 1 && move == &ai->moves->ultimate) {
-             ai->velocity.y += 0.5f; 
-        }
-
-        if (ai->velocity.y > 30.0f) ai->velocity.y = 30.0f;
-
-        ai->position = Vector2Add(ai->position, ai->velocity);
-
-        if (ai->position.y < -800.0f) {
-            ai->position.y = -800.0f;
-            if (ai->velocity.y < 0) ai->velocity.y = 0;
-        }
-
-        if (ai->position.y < GROUND_LEVEL) {
-            ai->isGrounded = false;
-        }
+static void BeginAISearch(const Player *ai, const Player *target, unsigned int targetHeld) {
+    cpuSearch.ai = *ai;
+    cpuSearch.target = *target;
+    cpuSearch.tick = simTick;
+    cpuSearch.targetHeld = targetHeld;
+    Combat_Clone(&searchWorld, &combatWorld);
+}
 
-        if (ai->position.x - PLAYER_HALF_WIDTH < 0) ai->position.x = PLAYER_HALF_WIDTH;
-        if (ai->position.x + PLAYER_HALF_WIDTH > GAME_WIDTH) ai->position.x = GAME_WIDTH - PLAYER_HALF_WIDTH;
+// Simula o plano contra uma resposta do oponente sobre cópias do estado
+// do início da busca, com o Sim_Step da partida, e pontua o resultado
+static float RolloutPlan(bool aiIsP1, const AIPlan *plan, unsigned int response) {
+    const Player *ai = &cpuSearch.ai;
+    const Player *target = &cpuSearch.target;
+    Player simAI = *ai;
+    Player simTarget = *target;
+    Combat_Clone(&rolloutWorld, &searchWorld);
+
+    PlayerInput *aiInput = &rolloutInputs[aiIsP1 ? 0 : 1];
+    PlayerInput *targetInput = &rolloutInputs[aiIsP1 ? 1 : 0];
+    Input_Init(aiInput, cpuControls, 0);
+    Input_Init(targetInput, cpuControls, 0);
+
+    Player *players[2] = { aiIsP1 ? &simAI : &simTarget, aiIsP1 ? &simTarget : &simAI };
+    PlayerInput *inputs[2] = { &rolloutInputs[0], &rolloutInputs[1] };
+
+    for (int frame = 0; frame < AI_LOOKAHEAD_FRAMES; frame++) {
+        unsigned int tick = cpuSearch.tick + frame;
+        Input_Feed(aiInput, PlanHeld(plan, &simAI, &simTarget), (frame == 0) ? plan->tapped : 0, tick);
+        Input_Feed(targetInput, cpuSearch.targetHeld, (frame == 0) ? response : 0, tick);
+
+        Sim_Step(players, inputs, &rolloutWorld, tick);
+        if (simAI.currentHealth <= 0 || simTarget.currentHealth <= 0) break;
+    }
 
-        if (ai->position.y > GROUND_LEVEL) {
-            if (move->selfVelocity.y > 0 || move->fallSpeed > 0) {
-                 
-                 if (move->type == MOVE_TYPE_ULTIMATE_FALL && ai->characterID == 0) {
-                     Move explosion = {0};
-                     explosion.type = MOVE_TYPE_ULTIMATE; 
-                     explosion.hitbox = (Rectangle){ -400, -500, 800, 600 }; 
-                     explosion.damage = 40.0f;
-                     explosion.knockback = (Vector2){ 25.0f, -25.0f };
-                     explosion.activeFrames = 10;
-                     Combat_TryExecuteMove(ai, &explosion, false);
+    float dealt = target->currentHealth - simTarget.currentHealth;
+    float taken = ai->currentHealth - simAI.currentHealth;
+    float score = dealt - 1.5f * taken;
 
-                     Vector2 explosionPos = { ai->position.x, GROUND_LEVEL - 30 };
-                     SpawnVfx(explosionPos, 0.0f, texExplosion, 4, 0.08f, 12.0f);
-                 }
+    if (simTarget.currentHealth <= 0) score += 1000.0f;
+    if (simAI.currentHealth <= 0) score -= 1000.0f;
 
-                 ai->position.y = GROUND_LEVEL;
-                 ai->state = PLAYER_STATE_IDLE;
-                 ai->currentMove = NULL;
-                 ai->velocity = (Vector2){0,0};
-                 ai->hasUsedAirSpecial = false;
-                 return;
-             }
-             
-             ai->position.y = GROUND_LEVEL;
-             ai->velocity.y = 0;
-             ai->isGrounded = true;
-        }
+    float distance = fabsf(simTarget.position.x - simAI.position.x);
+    score -= 0.05f * fabsf(distance - AI_PREFERRED_RANGE);
+    return score;
+}
 
-        int totalFrames = move->startupFrames + move->activeFrames + move->recoveryFrames;
-        if (ai->attackFrameCounter > totalFrames) {
-            if (ai->isGrounded) {
-                ai->state = PLAYER_STATE_IDLE;
-                ai->velocity = (Vector2){0,0};
-            } else {
-                ai->state = PLAYER_STATE_FALL;
-                ai->velocity.x *= 0.5f;
+// Controle virtual da CPU: avalia planos até esgotar o orçamento do tick,
+// retomando no tick seguinte; com todos avaliados, troca para o melhor.
+// Alimenta o PlayerInput como o teclado faria.
+static void ThinkAI(Player *ai, const Player *target, PlayerInput *input, unsigned int targetHeld) {
+    bool aiIsP1 = (ai == player1);
+
+    if (cpuSearch.planTicks >= AI_REPLAN_INTERVAL) {
+        double deadline = GetTime() + cpuBudgets[cpuDifficulty];
+        if (cpuSearch.nextPlan == 0 && cpuSearch.nextResponse == 0) BeginAISearch(ai, target, targetHeld);
+
+        while (GetTime() < deadline) {
+            const AIPlan *plan = &aiPlans[cpuSearch.nextPlan];
+            float score = RolloutPlan(aiIsP1, plan, aiResponses[cpuSearch.nextResponse]);
+            if (cpuSearch.nextResponse == 0 || score < cpuSearch.planScore) cpuSearch.planScore = score;
+
+            if (++cpuSearch.nextResponse < AI_RESPONSE_COUNT) continue;
+            cpuSearch.nextResponse = 0;
+
+            // Histerese: sem ganho claro, mantém o plano atual. Plano com toque
+            // não entra: repeti-lo cancelaria o próprio golpe em andamento.
+            if (cpuSearch.nextPlan == cpuSearch.activePlan && plan->tapped == 0) cpuSearch.planScore += 0.5f;
+            if (cpuSearch.nextPlan == 0 || cpuSearch.planScore > cpuSearch.bestScore) {
+                cpuSearch.bestPlan = cpuSearch.nextPlan;
+                cpuSearch.bestScore = cpuSearch.planScore;
             }
-            ai->currentMove = NULL;
-        }
-        return;
-    }
-
-    if (!ai->isGrounded) {
-        ai->velocity.y += 0.5f;
-        if (ai->velocity.y > 30.0f) ai->velocity.y = 30.0f;
 
-        if (ai->state != PLAYER_STATE_HURT) {
-            ai->state = PLAYER_STATE_FALL;
+            if (++cpuSearch.nextPlan == AI_PLAN_COUNT) {
+                cpuSearch.nextPlan = 0;
+                cpuSearch.activePlan = cpuSearch.bestPlan;
+                cpuSearch.planTicks = 0;
+                cpuSearch.pendingTap = true;
+                break;
+            }
         }
     }
-    ai->position = Vector2Add(ai->position, ai->velocity);
 
-    if (ai->position.y < -800.0f) {
-        ai->position.y = -800.0f;
-        if (ai->velocity.y < 0) ai->velocity.y = 0;
-    }
+    const AIPlan *plan = &aiPlans[cpuSearch.activePlan];
+    unsigned int tapped = cpuSearch.pendingTap ? plan->tapped : 0;
+    cpuSearch.pendingTap = false;
+    cpuSearch.planTicks++;
 
-    if (ai->position.x - PLAYER_HALF_WIDTH < 0) { ai->position.x = PLAYER_HALF_WIDTH; ai->velocity.x = 0; }
-    if (ai->position.x + PLAYER_HALF_WIDTH > GAME_WIDTH) { ai->position.x = GAME_WIDTH - PLAYER_HALF_WIDTH; ai->velocity.x = 0; }
-    
-    if (ai->position.y > GROUND_LEVEL) {
-        ai->position.y = GROUND_LEVEL;
-        ai->velocity.y = 0;
-        ai->isGrounded = true;
-        ai->hasUsedAirSpecial = false;
-        if (ai->state == PLAYER_STATE_FALL || ai->state == PLAYER_STATE_HURT) {
-            ai->state = PLAYER_STATE_IDLE;
-            ai->velocity.x = 0;
-        }
-    }
-    
-    if (ai->state != PLAYER_STATE_HURT) {
-        if (ai->velocity.x != 0 && ai->isGrounded) ai->state = PLAYER_STATE_WALK;
-        else if (ai->isGrounded && ai->state != PLAYER_STATE_JUMP) ai->state = PLAYER_STATE_IDLE;
-    }
+    Input_Feed(input, PlanHeld(plan, ai, target), tapped, simTick);
 }
 
 static void ResetRound(void) {
@@ -819,6 +592,7 @@ static void ResetRound(void) {
     player1->isFlipped = false;
     player1->poisonTimer = 0;
     player1->hasUsedAirSpecial = false;
+    player1->hasSuperArmor = false;
 
     player2->position = (Vector2){ 800, GROUND_LEVEL };
     player2->velocity = (Vector2){ 0, 0 };
@@ -829,13 +603,12 @@ static void ResetRound(void) {
     player2->isFlipped = true;
     player2->poisonTimer = 0;
     player2->hasUsedAirSpecial = false;
+    player2->hasSuperArmor = false;
 
-    if (!isMultiplayerMode) {
-        player2->aiState = AI_STATE_THINKING;
-        player2->aiTimer = 0;
-    }
+    ResetAISearch();
 
-    Combat_Cleanup(); 
+    Combat_Cleanup(&combatWorld); 
+    Particles_Clear();
 
     countdownTimer = 0;
     fightBannerTimer = 0;
@@ -854,173 +627,171 @@ void GameScene_SetMainFont(Font font) {
     mainFont = font;
 }
 
-void DrawPlayerSprite(Player *p, Color tint) {
-    if (p->spriteSheet.id == 0) return;
-
-    int columns = 5;
-    int frameX = p->currentAnimIndex % columns;
-    int frameY = p->currentAnimIndex / columns;
-
-    Rectangle sourceRec = {
-        (float)frameX * p->frameWidth,
-        (float)frameY * p->frameHeight,
-        (float)p->frameWidth,
-        (float)p->frameHeight
-    };
+void DrawPlayerSprite(const Player *p, const PlayerVisual *v, Color tint) {
+    if (v->sprites == NULL || v->sprites->texture.id == 0) return;
 
-    if (p->isFlipped) sourceRec.width = -sourceRec.width;
-
-    float scale = 3.0f;
-    
-    if (p->characterID == 1 && p->state == PLAYER_STATE_ATTACK) {
-        if (p->currentMove == &p->moves->ultimate) {
-            scale = 9.0f;
-        }
-    }
+    SpritePose pose = { 3.0f, 0.0f, false };
+    if (p->character->hooks.drawOverride) p->character->hooks.drawOverride(p, v, &pose);
 
     Rectangle destRec = {
         p->position.x, 
         p->position.y, 
-        p->frameWidth * scale,
-        p->frameHeight * scale 
+        v->sprites->frameWidth * pose.scale,
+        v->sprites->frameHeight * pose.scale 
     };
     
     float feetOffset = 38.0f; 
     Vector2 origin = { destRec.width / 2.0f, destRec.height - feetOffset }; 
-    float rotation = 0.0f;
 
-    if (p->characterID == 0 && p->state == PLAYER_STATE_ATTACK && p->currentAnimIndex == 19) {
+    if (pose.centerPivot) {
         origin.y = destRec.height / 2.0f; 
         destRec.y -= (destRec.height / 2.0f) - feetOffset; 
-
-        if (p->currentMove == &p->moves->specialSide) {
-            rotation = p->isFlipped ? -90.0f : 90.0f;
-        }
-        else if (p->currentMove == &p->moves->specialUp) {
-            rotation = 0.0f;
-        }
-        else if (p->currentMove == &p->moves->ultimate) {
-            if (p->velocity.y > 0) rotation = 180.0f;
-            else rotation = 0.0f;
-        }
     }
 
-    DrawTexturePro(p->spriteSheet, sourceRec, destRec, origin, rotation, tint);
+    SpriteAtlas_DrawFrame(v->sprites, v->currentAnimIndex, destRec, origin, pose.rotation, p->isFlipped, v->palette, tint);
 }
 
-void UpdatePlayerAnimation(Player *p, float dt) {
-    int start = 0;
-    int len = 1;
-    float speed = 0.12f;
-    bool loop = true;
-
-    if (p->characterID == 0) {
-        if (p->state == PLAYER_STATE_HURT) { start = 24; len = 1; loop = false; }
-        else if (p->state == PLAYER_STATE_ATTACK) {
-            loop = false; speed = 0.08f;
-            if (p->currentMove == &p->moves->specialSide || 
-                p->currentMove == &p->moves->specialUp || 
-                p->currentMove == &p->moves->ultimate) { start = 19; len = 1; loop = true; }
-            else if (p->currentMove == &p->moves->sideGround)      { start = 12; len = 2; }
-            else if (p->currentMove == &p->moves->upGround)   { start = 14; len = 3; }
-            else if (p->currentMove == &p->moves->neutralGround) { start = 17; len = 2; }
-            else if (p->currentMove == &p->moves->airSide)    { start = 20; len = 1; }
-            else if (p->currentMove == &p->moves->airUp)      { start = 21; len = 1; }
-            else if (p->currentMove == &p->moves->airDown)    { start = 22; len = 2; }
-            else { start = 12; len = 2; }
-        }
-        else if (p->state == PLAYER_STATE_JUMP) { start = 6; len = 4; speed = 0.1f; loop = false; }
-        else if (p->state == PLAYER_STATE_FALL) { start = 10; len = 2; speed = 0.15f; }
-        else if (p->state == PLAYER_STATE_WALK) { start = 2; len = 4; speed = 0.12f; }
-        else { start = 0; len = 2; speed = 0.3f; }
-    }
+// Só depende do estado do jogador: serve para CPU, replay e execução sem tela
+static AnimClip ResolveAnimClip(const Player *p) {
+    if (p->moves == NULL) return (AnimClip){ 0, 1, 0.12f, true };
 
-    else if (p->characterID == 1) {
-        if (p->state == PLAYER_STATE_HURT) { 
-            start = 50; len = 1; loop = false;
-        }
-        else if (p->state == PLAYER_STATE_ATTACK) {
-            loop = false; speed = 0.08f;
-            
-            if (p->currentMove == &p->moves->sideGround || p->currentMove == &p->moves->specialSide) 
-                { start = 13; len = 5; }
-            
-            else if (p->currentMove == &p->moves->neutralGround || p->currentMove == &p->moves->specialNeutral) 
-                { start = 18; len = 5; }
-            
-            else if (p->currentMove == &p->moves->upGround || p->currentMove == &p->moves->specialUp) 
-                { start = 23; len = 5; }
-            
-            else if (p->currentMove == &p->moves->downGround || p->currentMove == &p->moves->specialDown) 
-                { start = 28; len = 6; }
-            
-            else if (p->currentMove == &p->moves->airSide)    { start = 34; len = 5; }
-            else if (p->currentMove == &p->moves->airNeutral) { start = 39; len = 4; }
-            else if (p->currentMove == &p->moves->airDown)    { start = 43; len = 3; }
-            else if (p->currentMove == &p->moves->airUp)      { start = 46; len = 4; }
-            
-            else if (p->currentMove == &p->moves->ultimate) {
-                if (IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_RIGHT) || 
-                    IsKeyDown(KEY_A) || IsKeyDown(KEY_D)) {
-                    
-                    start = 4; len = 6; speed = 0.12f; loop = true;
-                } 
-                else {
-                    start = 0; len = 4; speed = 0.2f; loop = true;
-                }
-            }
-            else { start = 18; len = 5; }
-        }
-        else if (p->state == PLAYER_STATE_JUMP) { start = 10; len = 1; loop = false; }
-        else if (p->state == PLAYER_STATE_FALL) { start = 11; len = 2; speed = 0.15f; }
-        else if (p->state == PLAYER_STATE_WALK) { start = 4; len = 6; speed = 0.12f; }
-        else { start = 0; len = 4; speed = 0.2f; }
-    }
+    const CharacterAnims *anims = &p->moves->anims;
+    if (p->state != PLAYER_STATE_ATTACK) return anims->states[p->state];
+
+    int slot = Character_MoveSlot(p, p->currentMove);
+    if (slot < 0) return anims->states[PLAYER_STATE_ATTACK];
+
+    if (p->isSteering && anims->steering[slot].length > 0) return anims->steering[slot];
+    return anims->moves[slot];
+}
 
-    if (p->animStartFrame != start) {
-        p->animStartFrame = start;
-        p->animLength = len;
-        p->currentAnimIndex = start;
-        p->animTimer = 0;
-        p->animSpeed = speed;
-        p->loopAnim = loop;
+void UpdatePlayerAnimation(const Player *p, PlayerVisual *v, float dt) {
+    AnimClip clip = ResolveAnimClip(p);
+    int start = clip.start;
+    int len = clip.length;
+    float speed = clip.speed;
+    bool loop = clip.loop;
+
+    // Animação que passa do fim do atlas fica presa no último quadro existente
+    int available = (v->sprites != NULL) ? v->sprites->frameCount - start : 1;
+    if (len > available) len = (available > 0) ? available : 1;
+
+    if (v->animStartFrame != start) {
+        v->animStartFrame = start;
+        v->animLength = len;
+        v->currentAnimIndex = start;
+        v->animTimer = 0;
+        v->animSpeed = speed;
+        v->loopAnim = loop;
     }
 
-    p->animTimer += dt;
-    if (p->animTimer >= p->animSpeed) {
-        p->animTimer = 0;
-        p->currentAnimIndex++;
+    v->animTimer += dt;
+    if (v->animTimer >= v->animSpeed) {
+        v->animTimer = 0;
+        v->currentAnimIndex++;
 
-        if (p->currentAnimIndex >= p->animStartFrame + p->animLength) {
-            if (p->loopAnim) {
-                p->currentAnimIndex = p->animStartFrame;
+        if (v->currentAnimIndex >= v->animStartFrame + v->animLength) {
+            if (v->loopAnim) {
+                v->currentAnimIndex = v->animStartFrame;
             } else {
-                p->currentAnimIndex = p->animStartFrame + p->animLength - 1;
+                v->currentAnimIndex = v->animStartFrame + v->animLength - 1;
             }
         }
     }
 }
 
-void GameScene_SetLanguage(int lang) {
-    currentLanguage = lang;
+void GameScene_SetInputBuffer(int frames) {
+    inputBufferWindow = frames;
+    p1Input.bufferWindow = frames;
+    p2Input.bufferWindow = frames;
 }
 
-void PlayHurtSound(void) {
-    if (GetRandomValue(0, 1) == 0) {
-        PlaySound(sndHurt1);
-    } else {
-        PlaySound(sndHurt2);
+static void FlushInputs(void) {
+    Input_Flush(&p1Input);
+    Input_Flush(&p2Input);
+}
+
+// Efeitos dos eventos do combate. Um tick ressimulado (rollback) já foi
+// apresentado no primeiro passe e é ignorado.
+static void PresentCombatEvents(void) {
+    int count = 0;
+    const CombatEvent *events = Combat_GetEvents(&count);
+    if (count == 0 || events[0].tick <= presentedTick) return;
+    presentedTick = events[0].tick;
+
+    for (int i = 0; i < count; i++) {
+        const CombatEvent *event = &events[i];
+        switch (event->type) {
+            case COMBAT_EVENT_HIT:
+                // O veneno já tem a nuvem; faísca e som só nos golpes diretos
+                if (event->effect == EFFECT_POISON) break;
+                Particles_Emit(fxHitSpark, event->position, 0.0f);
+                SoundPool_Play(sndHurt);
+                break;
+            case COMBAT_EVENT_TRAP_SPAWN:
+                if (event->hasParticleVisual) Particles_Emit(fxSporeBurst, event->position, 0.0f);
+                break;
+            case COMBAT_EVENT_ROCKET_TRAIL:
+                Particles_Emit(fxRocketTrail, event->position, event->rotation);
+                break;
+            case COMBAT_EVENT_EXPLOSION:
+                Particles_Emit(fxExplosion, event->position, 0.0f);
+                break;
+            default:
+                break;
+        }
     }
 }
 
+static void BuildMatchResources(void) {
+    if (matchResources.textureCount > 0) return;
+
+    const int keep = TEXTURE_STREAM_KEEP;
+    ResourceSet_AddTexture(&matchResources, &texGuiFrame, "assets/gui_frame.png", keep, keep);
+    ResourceSet_AddTexture(&matchResources, &texSyringeEmptyL, "assets/lsyringe_empty.png", keep, keep);
+    ResourceSet_AddTexture(&matchResources, &texSyringeFullL, "assets/lsyringe_full.png", keep, keep);
+    ResourceSet_AddTexture(&matchResources, &texSyringeEmptyR, "assets/rsyringe_empty.png", keep, keep);
+    ResourceSet_AddTexture(&matchResources, &texSyringeFullR, "assets/rsyringe_full.png", keep, keep);
+    ResourceSet_AddTexture(&matchResources, &texPillEmptyL, "assets/lpill_empty.png", keep, keep);
+    ResourceSet_AddTexture(&matchResources, &texPillFullL, "assets/lpill_full.png", keep, keep);
+    ResourceSet_AddTexture(&matchResources, &texPillEmptyR, "assets/rpill_empty.png", keep, keep);
+    ResourceSet_AddTexture(&matchResources, &texPillFullR, "assets/rpill_full.png", keep, keep);
+    ResourceSet_AddTexture(&matchResources, &texTabletActive, "assets/tablet_active.png", keep, keep);
+    ResourceSet_AddTexture(&matchResources, &texTabletInactive, "assets/tablet_inactive.png", keep, keep);
+
+    ResourceSet_AddTexture(&matchResources, &texBackground, "assets/matchbg.png", TEXTURE_FILTER_POINT, keep);
+    ResourceSet_AddTexture(&matchResources, &texPoisonCloud, "assets/poison_cloud.png", TEXTURE_FILTER_POINT, keep);
+    for (int i = 0; i < CHARACTER_COUNT; i++) {
+        ResourceSet_AddTexture(&matchResources, &texCharacterIcons[i], Character_Get(i)->iconFile, TEXTURE_FILTER_POINT, keep);
+    }
+    ResourceSet_AddTexture(&matchResources, &texDNAProjectile, "assets/dna_projectile.png", TEXTURE_FILTER_POINT, keep);
+    ResourceSet_AddTexture(&matchResources, &texAmoebaProjectile, "assets/amoeba_projectile.png", TEXTURE_FILTER_POINT, keep);
+}
+
+void GameScene_Prefetch(void) {
+    BuildMatchResources();
+    ResourceSet_Request(&matchResources, RESOURCE_PRIORITY_PREFETCH);
+}
+
 void GameScene_Init(int p1CharacterID, int p2CharacterID) {
+    // Revanche sem passar pelo menu: a partida anterior ainda está carregada
+    if (isMatchLoaded) GameScene_Unload();
+    isMatchLoaded = true;
+
     sceneState = SCENE_STATE_START;
     matchWinner = 0;
     countdownTimer = 0;
     fightBannerTimer = 0;
 
-    player1 = (Player*)malloc(sizeof(Player));
+    simTick = 0;
+    presentedTick = 0;
+    Input_Init(&p1Input, p1Controls, inputBufferWindow);
+    Input_Init(&p2Input, p2Controls, inputBufferWindow);
+    Input_Init(&cpuInput, cpuControls, 0);
+
+    player1 = (Player*)calloc(1, sizeof(Player));
     player1->characterID = p1CharacterID;
+    player1->character = Character_Get(p1CharacterID);
     player1->position = (Vector2){ 400, GROUND_LEVEL };
     player1->velocity = (Vector2){ 0, 0 };
     player1->isGrounded = false;
@@ -1038,12 +809,15 @@ void GameScene_Init(int p1CharacterID, int p2CharacterID) {
     player1->roundsWon = 0;
     player1->poisonTimer = 0;
     player1->hasUsedAirSpecial = false;
+    player1->isSteering = false;
+    player1->hasSuperArmor = false;
     
-    player1->moves = LoadMovesetFromJSON(GetCharacterJSON(p1CharacterID));
-    TextCopy(player1->name, GetCharacterName(p1CharacterID));
+    player1->moves = Character_GetMoveset(player1->character);
+    TextCopy(visuals[0].name, Loc_GetCharacterName(p1CharacterID));
 
-    player2 = (Player*)malloc(sizeof(Player));
+    player2 = (Player*)calloc(1, sizeof(Player));
     player2->characterID = p2CharacterID;
+    player2->character = Character_Get(p2CharacterID);
     player2->position = (Vector2){ 800, GROUND_LEVEL };
     player2->velocity = (Vector2){ 0, 0 };
     player2->isGrounded = false;
@@ -1061,106 +835,63 @@ void GameScene_Init(int p1CharacterID, int p2CharacterID) {
     player2->roundsWon = 0;
     player2->poisonTimer = 0;
     player2->hasUsedAirSpecial = false;
+    player2->isSteering = false;
+    player2->hasSuperArmor = false;
 
-    player2->moves = LoadMovesetFromJSON(GetCharacterJSON(p2CharacterID));
-    TextCopy(player2->name, GetCharacterName(p2CharacterID));
-
-    if (isMultiplayerMode) {
-        player2->isCPU = false;
-        player2->aiState = 0;
-    } else {
-        player2->isCPU = true;
-        player2->aiState = AI_STATE_THINKING;
-        player2->aiTimer = 0;
-    }
-
-    Combat_Init();
-
-    texGuiFrame = LoadTexture("assets/gui_frame.png");
-    texSyringeEmptyL = LoadTexture("assets/lsyringe_empty.png");
-    texSyringeFullL = LoadTexture("assets/lsyringe_full.png");
-    texSyringeEmptyR = LoadTexture("assets/rsyringe_empty.png");
-    texSyringeFullR = LoadTexture("assets/rsyringe_full.png");
-    texPillEmptyL = LoadTexture("assets/lpill_empty.png");
-    texPillFullL = LoadTexture("assets/lpill_full.png");
-    texPillEmptyR = LoadTexture("assets/rpill_empty.png");
-    texPillFullR = LoadTexture("assets/rpill_full.png");
-    texTabletActive = LoadTexture("assets/tablet_active.png");
-    texTabletInactive = LoadTexture("assets/tablet_inactive.png");
-
-    texBackground = LoadTexture("assets/matchbg.png");
-    SetTextureFilter(texBackground, TEXTURE_FILTER_POINT);
-
-    if (p1CharacterID == 0) player1->spriteSheet = LoadTexture("assets/Bacteriofago.png");
-    else if (p1CharacterID == 1) player1->spriteSheet = LoadTexture("assets/Ameba.png");
-
-    if (p2CharacterID == 0) player2->spriteSheet = LoadTexture("assets/Bacteriofago.png");
-    else if (p2CharacterID == 1) player2->spriteSheet = LoadTexture("assets/Ameba.png");
-
-    SetTextureFilter(player1->spriteSheet, TEXTURE_FILTER_POINT);
-    SetTextureFilter(player2->spriteSheet, TEXTURE_FILTER_POINT);
-
-    texRocketVfx = LoadTexture("assets/rocketfx.png");
-    SetTextureFilter(texRocketVfx, TEXTURE_FILTER_POINT);
-
-    texPoisonCloud = LoadTexture("assets/poison_cloud.png");
-    SetTextureFilter(texPoisonCloud, TEXTURE_FILTER_POINT);
-
-    texExplosion = LoadTexture("assets/explosion.png");
-    SetTextureFilter(texExplosion, TEXTURE_FILTER_POINT);
-
-    texHitVfx = LoadTexture("assets/hit.png");
-    SetTextureFilter(texHitVfx, TEXTURE_FILTER_POINT);
-
-    texBactIcon = LoadTexture("assets/bacteriophage_icon.png");
-    SetTextureFilter(texBactIcon, TEXTURE_FILTER_POINT);
-
-    texAmoebaIcon = LoadTexture("assets/amoeba_icon.png");
-    SetTextureFilter(texAmoebaIcon, TEXTURE_FILTER_POINT);
-
-    texDNAProjectile = LoadTexture("assets/dna_projectile.png");
-    SetTextureFilter(texDNAProjectile, TEXTURE_FILTER_POINT);
-
-    texAmoebaProjectile = LoadTexture("assets/amoeba_projectile.png");
-    SetTextureFilter(texAmoebaProjectile, TEXTURE_FILTER_POINT);
+    player2->moves = Character_GetMoveset(player2->character);
+    TextCopy(visuals[1].name, Loc_GetCharacterName(p2CharacterID));
 
-    texSpore = LoadTexture("assets/spore.png");
-    SetTextureFilter(texAmoebaProjectile, TEXTURE_FILTER_POINT);
+    player2->isCPU = !isMultiplayerMode;
+    ResetAISearch();
 
-    sndHurt1 = LoadSound("assets/audio/hurt1.ogg");
-    sndHurt2 = LoadSound("assets/audio/hurt2.ogg");
+    Combat_Init(&combatWorld);
 
-    player1->vfxSpawnTimer = 0.7f;
-    player2->vfxSpawnTimer = 0.7f;
+    BuildMatchResources();
+    ResourceSet_Finish(&matchResources);
 
-    player1->frameWidth = player1->spriteSheet.width / 5;
-    if (p1CharacterID == 1) player1->frameHeight = player1->spriteSheet.width / 5; 
-    else player1->frameHeight = player1->spriteSheet.height / 5;
+    // Espelho: uma textura só, o P2 se diferencia pela linha da paleta
+    SpriteAtlas_LoadPaletteShader();
+    LoadCharacterSprites(&characterSprites[0], player1->character);
+    visuals[0].sprites = &characterSprites[0];
+    visuals[0].palette = PALETTE_ORIGINAL;
 
-    player1->animTimer = 0.0f;
-    player1->animSpeed = 0.15f;
-    player1->currentAnimIndex = 0;
-    player1->animStartFrame = 0;
-    player1->animLength = 2;
-
-    player2->frameWidth = player2->spriteSheet.width / 5;
-    if (p2CharacterID == 1) player2->frameHeight = player2->spriteSheet.width / 5; 
-    else player2->frameHeight = player2->spriteSheet.height / 5;
+    if (p2CharacterID == p1CharacterID) {
+        visuals[1].sprites = &characterSprites[0];
+        visuals[1].palette = PALETTE_HUE_240;
+    } else {
+        LoadCharacterSprites(&characterSprites[1], player2->character);
+        visuals[1].sprites = &characterSprites[1];
+        visuals[1].palette = PALETTE_COOL_TINT;
+    }
 
-    player2->animTimer = 0.0f;
-    player2->animSpeed = 0.15f;
-    player2->currentAnimIndex = 0;
-    player2->animStartFrame = 0;
-    player2->animLength = 2;
+    Particles_Load("assets/data/particles.json");
+    fxHitSpark = Particles_FindEmitter("hit_spark");
+    fxSporeBurst = Particles_FindEmitter("spore_burst");
+    fxRocketTrail = Particles_FindEmitter("rocket_trail");
+    fxExplosion = Particles_FindEmitter("explosion");
+
+    sndHurt = SoundPool_Load("assets/audio/hurt1.ogg", HURT_SOUND_INSTANCES, SOUND_PRIORITY_NORMAL);
+    SoundPool_AddVariant(sndHurt, "assets/audio/hurt2.ogg");
+
+    for (int i = 0; i < 2; i++) {
+        visuals[i].animTimer = 0.0f;
+        visuals[i].animSpeed = 0.15f;
+        visuals[i].currentAnimIndex = 0;
+        visuals[i].animStartFrame = 0;
+        visuals[i].animLength = 2;
+    }
 }
 
 int GameScene_Update(void) {
-    float dt = GetFrameTime();
+    float dt = SIM_TICK_TIME;
 
-    UpdateVfx(dt);
+    Input_BeginTick();
+    SoundPool_BeginTick();
 
-    UpdatePlayerAnimation(player1, dt);
-    UpdatePlayerAnimation(player2, dt);
+    Particles_Update(dt);
+
+    UpdatePlayerAnimation(player1, &visuals[0], dt);
+    UpdatePlayerAnimation(player2, &visuals[1], dt);
 
     if (IsKeyPressed(KEY_P)) {
         if (sceneState == SCENE_STATE_PLAY) {
@@ -1169,6 +900,7 @@ int GameScene_Update(void) {
         }
         else if (sceneState == SCENE_STATE_PAUSED) {
             sceneState = SCENE_STATE_PLAY;
+            FlushInputs();
         }
     }
 
@@ -1177,23 +909,28 @@ int GameScene_Update(void) {
             countdownTimer++;
             if (countdownTimer > 180) {
                 sceneState = SCENE_STATE_PLAY;
+                FlushInputs();
             }
             break;
             
         case SCENE_STATE_PLAY:
             if (fightBannerTimer < 120) fightBannerTimer++;
 
-            InputConfig p1Controls = { KEY_A, KEY_D, KEY_W, KEY_S, KEY_SPACE, KEY_J, KEY_K };
-            UpdateHuman(player1, dt, p1Controls);
+            // O relógio da simulação só anda na luta: pausa não consome cooldown
+            simTick++;
+            Combat_BeginTick(simTick);
 
-            if (isMultiplayerMode) {
-                InputConfig p2Controls = { KEY_LEFT, KEY_RIGHT, KEY_UP, KEY_DOWN, KEY_KP_0, KEY_KP_1, KEY_KP_2 };
-                UpdateHuman(player2, dt, p2Controls);
-            } else {
-                UpdateAI(player2, player1, dt);
+            Input_Capture(&p1Input, simTick);
+            if (isMultiplayerMode) Input_Capture(&p2Input, simTick);
+            else ThinkAI(player2, player1, &cpuInput, p1Input.frame.held & AI_DIRECTION_BUTTONS);
+
+            {
+                Player *players[2] = { player1, player2 };
+                PlayerInput *inputs[2] = { &p1Input, isMultiplayerMode ? &p2Input : &cpuInput };
+                Sim_Step(players, inputs, &combatWorld, simTick);
             }
 
-            Combat_Update(player1, player2);
+            PresentCombatEvents();
 
             if (player1->currentHealth <= 0 || player2->currentHealth <= 0) {
                 if (player1->currentHealth <= 0) player2->roundsWon++;
@@ -1217,6 +954,7 @@ int GameScene_Update(void) {
             if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_SPACE)) {
                 if (pauseOption == 0) {
                     sceneState = SCENE_STATE_PLAY;
+                    FlushInputs();
                 }
                 else if (pauseOption == 1) {
                     return 2;
@@ -1255,12 +993,12 @@ void GameScene_Draw(void) {
     Vector2 origin      = { 0.0f, 0.0f };
     DrawTexturePro(texBackground, sourceRec, destRec, origin, 0.0f, WHITE);
 
-    DrawPlayerSprite(player1, WHITE);
-    DrawPlayerSprite(player2, (Color){200, 200, 255, 255});
+    DrawPlayerSprite(player1, &visuals[0], WHITE);
+    DrawPlayerSprite(player2, &visuals[1], WHITE);
     
-    DrawVfx();
+    Particles_Draw();
 
-    Combat_Draw(player1, player2, texPoisonCloud, texDNAProjectile, texAmoebaProjectile, texSpore);
+    Combat_Draw(&combatWorld, texPoisonCloud, texDNAProjectile, texAmoebaProjectile);
 
     float uiScale = 1.7f;
     float frameW = texGuiFrame.width * uiScale;
@@ -1276,8 +1014,8 @@ void GameScene_Draw(void) {
     float slotMarginX = -4.0f; 
     float slotMarginY = -7.0f;
     
-    if (player1->currentAnimIndex >= 0) {
-        Texture2D iconToDraw = (player1->characterID == 1) ? texAmoebaIcon : texBactIcon;
+    if (visuals[0].currentAnimIndex >= 0) {
+        Texture2D iconToDraw = texCharacterIcons[player1->character->id];
         
         float iconW = iconToDraw.width * iconScaleHUD;
         float iconH = iconToDraw.height * iconScaleHUD;
@@ -1288,8 +1026,8 @@ void GameScene_Draw(void) {
         DrawTextureEx(iconToDraw, (Vector2){drawX, drawY}, 0.0f, iconScaleHUD, WHITE);
     }
 
-    if (player2->currentAnimIndex >= 0) {
-        Texture2D iconToDraw = (player2->characterID == 1) ? texAmoebaIcon : texBactIcon;
+    if (visuals[1].currentAnimIndex >= 0) {
+        Texture2D iconToDraw = texCharacterIcons[player2->character->id];
 
         float iconW = iconToDraw.width * iconScaleHUD;
         float iconH = iconToDraw.height * iconScaleHUD;
@@ -1408,14 +1146,14 @@ void GameScene_Draw(void) {
         startX + (nameOffsetX * uiScale),
         startY + (nameOffsetY * uiScale)
     };
-    DrawTextEx(hudFont, player1->name, p1NamePos, fontSize, fontSpacing, nameColor);
+    DrawTextCached(hudFont, visuals[0].name, p1NamePos, fontSize, fontSpacing, nameColor);
 
-    Vector2 p2NameSize = MeasureTextEx(hudFont, player2->name, fontSize, fontSpacing);
+    Vector2 p2NameSize = MeasureTextCached(hudFont, visuals[1].name, fontSize, fontSpacing);
     Vector2 p2NamePos = { 
         (startX + frameW) - (nameOffsetX * uiScale) - p2NameSize.x,
         startY + (nameOffsetY * uiScale)
     };
-    DrawTextEx(hudFont, player2->name, p2NamePos, fontSize, fontSpacing, nameColor);
+    DrawTextCached(hudFont, visuals[1].name, p2NamePos, fontSize, fontSpacing, nameColor);
 
     if (sceneState == SCENE_STATE_START) {
         const char* countdownText = "";
@@ -1425,23 +1163,23 @@ void GameScene_Draw(void) {
         
         float cdSize = hudFont.baseSize * 4.0f;
         float cdSpacing = 4.0f;
-        Vector2 txtSize = MeasureTextEx(hudFont, countdownText, cdSize, cdSpacing);
+        Vector2 txtSize = MeasureTextCached(hudFont, countdownText, cdSize, cdSpacing);
         
-        DrawTextEx(hudFont, countdownText, 
+        DrawTextCached(hudFont, countdownText, 
             (Vector2){(GAME_WIDTH - txtSize.x)/2, (GAME_HEIGHT - txtSize.y)/2}, 
             cdSize, cdSpacing, YELLOW);
     }
 
     if (sceneState == SCENE_STATE_PLAY && fightBannerTimer < 60) {
-        const char* fightText = (currentLanguage == 0) ? "FIGHT!" : "LUTEM!";
+        const char* fightText = Loc_Get(STR_FIGHT);
         
         float fSize = hudFont.baseSize * 5.0f;
         float fSpacing = 5.0f;
-        Vector2 txtSize = MeasureTextEx(hudFont, fightText, fSize, fSpacing);
+        Vector2 txtSize = Loc_Measure(STR_FIGHT, hudFont, fSize, fSpacing);
         
         Color fightColor = (fightBannerTimer % 10 < 5) ? RED : ORANGE;
         
-        DrawTextEx(hudFont, fightText, 
+        DrawTextCached(hudFont, fightText, 
             (Vector2){(GAME_WIDTH - txtSize.x)/2, (GAME_HEIGHT - txtSize.y)/2}, 
             fSize, fSpacing, fightColor);
     }
@@ -1449,37 +1187,32 @@ void GameScene_Draw(void) {
         const char* text = "KO!";
         float kSize = hudFont.baseSize * 5.0f;
         float kSpacing = 5.0f;
-        Vector2 txtSize = MeasureTextEx(hudFont, text, kSize, kSpacing);
+        Vector2 txtSize = MeasureTextCached(hudFont, text, kSize, kSpacing);
 
-        DrawTextEx(hudFont, text, 
+        DrawTextCached(hudFont, text, 
             (Vector2){(GAME_WIDTH - txtSize.x)/2, (GAME_HEIGHT - txtSize.y)/2}, 
             kSize, kSpacing, RED);
     }
     else if (sceneState == SCENE_STATE_GAME_OVER) {
         DrawRectangle(0, 0, GAME_WIDTH, GAME_HEIGHT, (Color){0,0,0, 200});
         
-        char wText[50];
-        if (currentLanguage == 0) {
-            sprintf(wText, (matchWinner == 1) ? "PLAYER 1 WINS!" : "PLAYER 2 WINS!");
-        } else {
-            sprintf(wText, (matchWinner == 1) ? "JOGADOR 1 VENCEU!" : "JOGADOR 2 VENCEU!");
-        }
+        StringID wText = (matchWinner == 1) ? STR_P1_WINS : STR_P2_WINS;
         
         Color wColor = (matchWinner == 1) ? GREEN : BLUE;
         
         float wSize = hudFont.baseSize * 3.0f;
         float wSpacing = 3.0f;
-        Vector2 wTxtSize = MeasureTextEx(hudFont, wText, wSize, wSpacing);
+        Vector2 wTxtSize = Loc_Measure(wText, hudFont, wSize, wSpacing);
 
-        DrawTextEx(hudFont, wText, 
+        DrawTextCached(hudFont, Loc_Get(wText), 
             (Vector2){(GAME_WIDTH - wTxtSize.x)/2, GAME_HEIGHT/2 - 50}, 
             wSize, wSpacing, wColor);
 
-        const char* subText = (currentLanguage == 0) ? "Press ENTER to Return" : "Pressione ENTER para Voltar";
+        const char* subText = Loc_Get(STR_PRESS_ENTER_RETURN);
         float subSize = mainFont.baseSize * 1.5f; 
-        Vector2 subTxtSize = MeasureTextEx(mainFont, subText, subSize, 2.0f);
+        Vector2 subTxtSize = Loc_Measure(STR_PRESS_ENTER_RETURN, mainFont, subSize, 2.0f);
 
-        DrawTextEx(mainFont, subText, 
+        DrawTextCached(mainFont, subText, 
             (Vector2){(GAME_WIDTH - subTxtSize.x)/2, GAME_HEIGHT/2 + 40}, 
             subSize, 2.0f, RAYWHITE);
     }
@@ -1495,69 +1228,56 @@ void GameScene_Draw(void) {
         DrawRectangle(menuX, menuY, menuW, menuH, (Color){ 20, 30, 60, 240 });
         DrawRectangleLinesEx((Rectangle){menuX, menuY, menuW, menuH}, 4, SKYBLUE);
 
-        const char* title = (currentLanguage == 0) ? "PAUSED" : "PAUSA";
+        const char* title = Loc_Get(STR_PAUSED);
         float tSize = mainFont.baseSize * 2.0f;
         float tSpacing = 2.0f;
-        Vector2 tTxtSize = MeasureTextEx(mainFont, title, tSize, tSpacing);
+        Vector2 tTxtSize = Loc_Measure(STR_PAUSED, mainFont, tSize, tSpacing);
 
-        DrawTextEx(mainFont, title, 
+        DrawTextCached(mainFont, title, 
             (Vector2){(GAME_WIDTH - tTxtSize.x)/2, menuY + 30}, 
             tSize, tSpacing, WHITE);
 
         int startOptY = menuY + 120;
         int spacing = 50;
 
-        const char* optsEN[] = { "RESUME", "SETTINGS", "QUIT MATCH" };
-        const char* optsPT[] = { "CONTINUAR", "CONFIGURACOES", "SAIR DA PARTIDA" };
-        const char** currentOpts = (currentLanguage == 0) ? optsEN : optsPT;
-
         for (int i = 0; i < 3; i++) {
             Color color = (i == pauseOption) ? YELLOW : GRAY;
             
             float optSize = (i == pauseOption) ? mainFont.baseSize * 1.5f : mainFont.baseSize * 1.2f;
             
-            const char* txt = currentOpts[i];
+            const char* txt = Loc_Get(STR_PAUSE_RESUME + i);
             
-            Vector2 optTxtSize = MeasureTextEx(mainFont, txt, optSize, 2.0f);
+            Vector2 optTxtSize = Loc_Measure(STR_PAUSE_RESUME + i, mainFont, optSize, 2.0f);
             float drawX = (GAME_WIDTH - optTxtSize.x)/2;
             
-            DrawTextEx(mainFont, txt, (Vector2){drawX, startOptY + (i * spacing)}, optSize, 2.0f, color);
+            DrawTextCached(mainFont, txt, (Vector2){drawX, startOptY + (i * spacing)}, optSize, 2.0f, color);
         }
     }
 }
 
+// Pode ser chamada mais de uma vez (saída da cena e fim do programa)
 void GameScene_Unload(void) {
-    UnloadTexture(texBackground);
-    UnloadTexture(texGuiFrame);
-    UnloadTexture(texSyringeEmptyL); UnloadTexture(texSyringeFullL);
-    UnloadTexture(texSyringeEmptyR); UnloadTexture(texSyringeFullR);
-    UnloadTexture(texPillEmptyL);    UnloadTexture(texPillFullL);
-    UnloadTexture(texPillEmptyR);    UnloadTexture(texPillFullR);
-    UnloadTexture(texTabletActive);  UnloadTexture(texTabletInactive);
+    ResourceSet_Release(&matchResources);
+
+    SpriteAtlas_Unload(&characterSprites[0]);
+    SpriteAtlas_Unload(&characterSprites[1]);
+    SpriteAtlas_UnloadPaletteShader();
 
     if (player1 != NULL) {
-        if (player1->moves != NULL) free(player1->moves);
         free(player1);
         player1 = NULL;
     }
     if (player2 != NULL) {
-        if (player2->moves != NULL) free(player2->moves);
         free(player2);
         player2 = NULL;
     }
 
-    UnloadTexture(texRocketVfx);
-    UnloadTexture(texPoisonCloud);
-    UnloadTexture(texExplosion);
-    UnloadTexture(texHitVfx);
-    UnloadTexture(texBactIcon);
-    UnloadTexture(texAmoebaIcon);
-    UnloadTexture(texDNAProjectile);
-    UnloadTexture(texAmoebaProjectile);
-    UnloadTexture(texSpore);
-    Vfx_Cleanup();
-    UnloadSound(sndHurt1);
-    UnloadSound(sndHurt2);
-
-    Combat_Cleanup();
+    if (isMatchLoaded) {
+        Particles_Unload();
+        SoundPool_Unload(sndHurt);
+        sndHurt = SOUND_NONE;
+    }
+
+    Combat_Cleanup(&combatWorld);
+    isMatchLoaded = false;
 }
\ No newline at end of file
@@ -2,11 +2,22 @@
 #define GAME_SCENE_H
 
 #include "raylib.h"
+#include "sprite_atlas.h"
 
 #define GAME_WIDTH 1200
 #define GAME_HEIGHT 720
 #define GROUND_LEVEL 640.0f
 
+#define SIM_TICK_RATE 60
+#define SIM_TICK_TIME (1.0f / SIM_TICK_RATE)
+
+#define CACHE_LINE_SIZE 64
+
+// Capacidade fixa do mundo de combate: clonar é só copiar vetores
+#define COMBAT_MAX_HITBOXES 32
+#define COMBAT_MAX_PROJECTILES 32
+#define COMBAT_MAX_TRAPS 16
+
 // --- ENUMS ---
 
 typedef enum {
@@ -33,54 +44,133 @@ typedef enum {
     PLAYER_STATE_FALL,
     PLAYER_STATE_ATTACK,
     PLAYER_STATE_HURT,
-    PLAYER_STATE_DEAD
+    PLAYER_STATE_DEAD,
+    PLAYER_STATE_COUNT
 } PlayerState;
 
+// Posição de cada golpe em Moveset.list, na ordem dos campos nomeados
+typedef enum {
+    MOVE_SLOT_SIDE_GROUND,
+    MOVE_SLOT_UP_GROUND,
+    MOVE_SLOT_DOWN_GROUND,
+    MOVE_SLOT_NEUTRAL_GROUND,
+    MOVE_SLOT_AIR_SIDE,
+    MOVE_SLOT_AIR_UP,
+    MOVE_SLOT_AIR_DOWN,
+    MOVE_SLOT_AIR_NEUTRAL,
+    MOVE_SLOT_SPECIAL_NEUTRAL,
+    MOVE_SLOT_SPECIAL_SIDE,
+    MOVE_SLOT_SPECIAL_UP,
+    MOVE_SLOT_SPECIAL_DOWN,
+    MOVE_SLOT_ULTIMATE,
+    MOVE_SLOT_COUNT
+} MoveSlot;
+
+// Dificuldade da CPU = tempo de busca por tick
 typedef enum {
-    AI_STATE_THINKING,
-    AI_STATE_APPROACH,
-    AI_STATE_ATTACK,
-    AI_STATE_FLEE
-} AIState;
+    CPU_DIFFICULTY_EASY,
+    CPU_DIFFICULTY_NORMAL,
+    CPU_DIFFICULTY_HARD,
+    CPU_DIFFICULTY_COUNT
+} CPUDifficulty;
 
 typedef enum {
     LANG_EN,
-    LANG_PT
+    LANG_PT,
+    LANG_COUNT
 } GameLanguage;
 
+typedef enum {
+    PRESENT_VSYNC,
+    PRESENT_UNCAPPED,
+    PRESENT_LOW_LATENCY,
+    PRESENT_MODE_COUNT
+} PresentMode;
+
+// O que acontece em cada frame de um golpe. Compilado do JSON ao carregar o
+// moveset, para o tick só consultar a tabela.
+typedef enum {
+    MOVE_FRAME_SPAWN         = 1 << 0,      // cria o hitbox/projétil/armadilha do golpe
+    MOVE_FRAME_SELF_VELOCITY = 1 << 1,
+    MOVE_FRAME_STEER         = 1 << 2,
+    MOVE_FRAME_CANCEL        = 1 << 3,      // aceita o ataque seguinte do combo
+    MOVE_FRAME_TRAIL_SIDE    = 1 << 4,      // rastro de foguete, por direção
+    MOVE_FRAME_TRAIL_UP      = 1 << 5,
+    MOVE_FRAME_TRAIL_DOWN    = 1 << 6,
+    MOVE_FRAME_SPAWN_CLOUD   = 1 << 7,      // nuvem de veneno no pico do ultimate em queda
+    MOVE_FRAME_HANG          = 1 << 8,
+    MOVE_FRAME_FALL          = 1 << 9,
+    MOVE_FRAME_GRAVITY       = 1 << 10,
+    MOVE_FRAME_JUMP          = 1 << 11,
+    MOVE_FRAME_LAND_END      = 1 << 12,     // tocar o chão encerra o golpe
+    MOVE_FRAME_LAND_EXPLODE  = 1 << 13,
+    MOVE_FRAME_END           = 1 << 14
+} MoveFrameFlag;
+
+#define MOVE_FRAME_TRAIL (MOVE_FRAME_TRAIL_SIDE | MOVE_FRAME_TRAIL_UP | MOVE_FRAME_TRAIL_DOWN)
+
 // --- STRUCTS DE DADOS (Moveset, Input, Settings) ---
 
+// Só dados de frame, imutáveis depois de carregados: o Moveset é compartilhado
+// entre jogadores. Campos ordenados por tamanho para caber em duas linhas de cache.
 typedef struct Move {
-    char name[32];
+    const unsigned short *timeline; // MoveFrameFlag por frame; o último tem MOVE_FRAME_END
+    int frameCount;
     int startupFrames;
     int activeFrames;
     int recoveryFrames;
+    MoveType type;
+    MoveEffect effect;
+
     Rectangle hitbox;
     Vector2 knockback;
     float damage;
-
-    MoveType type;
-    MoveEffect effect;
     float effectDuration;
     Vector2 projectileSpeed;
 
     Vector2 selfVelocity;
     float steerSpeed;
     float fallSpeed;
+    int cooldownFrames;
+    float trapDuration;
+    int maxCombo;
     bool multiHit;
     bool canCombo;
-    int maxCombo;
-    
-    float cooldown;
-    float lastUsedTime;
-    float trapDuration;
+    bool steerTurns;                // conduzir também vira o personagem
 } Move;
 
+_Static_assert(sizeof(Move) <= 2 * CACHE_LINE_SIZE, "Move passou de duas linhas de cache");
+
+typedef struct {
+    int start;
+    int length;
+    float speed;                // segundos por quadro
+    bool loop;
+} AnimClip;
+
+// Animações de um personagem: fora de ataque, indexadas pelo estado; em
+// ataque, pelo slot do golpe. steering (length 0 = não tem) substitui o
+// clipe do golpe enquanto o jogador conduz.
+typedef struct {
+    AnimClip states[PLAYER_STATE_COUNT];
+    AnimClip moves[MOVE_SLOT_COUNT];
+    AnimClip steering[MOVE_SLOT_COUNT];
+} CharacterAnims;
+
 typedef struct Moveset {
-    Move sideGround, upGround, downGround, neutralGround;
-    Move airSide, airUp, airDown, airNeutral;
-    Move specialNeutral, specialSide, specialUp, specialDown;
-    Move ultimate;
+    union {
+        struct {
+            Move sideGround, upGround, downGround, neutralGround;
+            Move airSide, airUp, airDown, airNeutral;
+            Move specialNeutral, specialSide, specialUp, specialDown;
+            Move ultimate;
+        };
+        Move list[MOVE_SLOT_COUNT];
+    };
+
+    // Frio: não é lido pelo passo de física
+    char names[MOVE_SLOT_COUNT][32];
+    CharacterAnims anims;
 } Moveset;
 
 typedef struct {
@@ -100,57 +190,70 @@ typedef struct {
     int resolutionIndex;    
     bool fullscreen;
     GameLanguage language;
+    PresentMode presentMode;
+    int inputBufferFrames;
+    CPUDifficulty cpuDifficulty;
 } GameSettings;
 
 // --- STRUCTS DO JOGO (Player e Objetos de Combate) ---
 
+struct CharacterDef;
+
+// Estado de simulação, e só ele: é o que um snapshot precisa copiar.
+// Ponteiros e vetores do tick na frente, flags e cooldowns no fim.
 typedef struct Player {
-    Texture2D spriteSheet;
-    int frameWidth;
-    int frameHeight;
-    int currentAnimIndex;
-    int animStartFrame;
-    int animLength;
-    float vfxSpawnTimer;
-    float animTimer;
-    float animSpeed;
-    bool loopAnim;
-    char name[32];
+    const Moveset *moves;           // do registro, compartilhado
+    const Move *currentMove;
+    const struct CharacterDef *character;
+
     Vector2 position;
-    Vector2 ultLaunchPos;
     Vector2 velocity;
-    bool isGrounded;
-    bool isFlipped;
     PlayerState state;
     int attackFrameCounter;
-    Moveset *moves;
-    Move *currentMove;
-    int characterID;
-    
-    float health;
-    float maxHealth;
+    Vector2 ultLaunchPos;
+
     float currentHealth;
-    int maxUlt;
-    int currentUlt;
+    float maxHealth;
+    float poisonTimer;
     float ultCharge;
     float maxUltCharge;
     float chargePerPill;
+    int currentUlt;
+    int maxUlt;
     int roundsWon;
-    float poisonTimer;
-    bool hasUsedAirSpecial;
+    int characterID;
 
+    bool isGrounded;
+    bool isFlipped;
+    bool isSteering;            // esquerda/direita segurados num frame de condução
+    bool hasUsedAirSpecial;
+    bool hasSuperArmor;         // mantido pelo onTick do personagem
     bool isCPU;
-    AIState aiState;
-    int aiTimer;
+
+    unsigned int moveReadyTick[MOVE_SLOT_COUNT];    // tick em que cada golpe sai do cooldown
 } Player;
 
+_Static_assert(sizeof(Player) <= 3 * CACHE_LINE_SIZE, "Player passou de tres linhas de cache");
+
+// Apresentação do jogador: animação, sprite e nome. Fica fora da simulação.
+typedef struct PlayerVisual {
+    const SpriteAtlas *sprites;
+    PaletteVariant palette;
+    int currentAnimIndex;
+    int animStartFrame;
+    int animLength;
+    float animTimer;
+    float animSpeed;
+    bool loopAnim;
+    char name[32];
+} PlayerVisual;
+
 typedef struct HitboxNode {
     Rectangle size;
     float damage;
     Vector2 knockback;
     int lifetime;
     bool isPlayer1;
-    struct HitboxNode *next;
     float relX; 
     float relY;
     
@@ -167,7 +270,6 @@ typedef struct ProjectileNode {
     Vector2 knockback;
     int lifetime;
     bool isPlayer1;
-    struct ProjectileNode *next;
     
     bool spawnTrapOnGround;
     float trapDuration;
@@ -182,34 +284,76 @@ typedef struct TrapNode {
     float damage;
     float duration;
     bool isPlayer1;
-    struct TrapNode *next;
     
     MoveEffect effect;
     MoveType moveType;
+    bool hasParticleVisual;
 } TrapNode;
 
+// Tudo o que o combate cria durante a luta. Sem ponteiros: um clone é
+// independente do original e pode ser simulado à frente (busca da CPU).
+typedef struct {
+    HitboxNode hitboxes[COMBAT_MAX_HITBOXES];
+    ProjectileNode projectiles[COMBAT_MAX_PROJECTILES];
+    TrapNode traps[COMBAT_MAX_TRAPS];
+    int hitboxCount;
+    int projectileCount;
+    int trapCount;
+    bool isRecordingEvents;
+} CombatWorld;
+
+typedef enum {
+    COMBAT_EVENT_HIT,
+    COMBAT_EVENT_PROJECTILE_SPAWN,
+    COMBAT_EVENT_PROJECTILE_EXPIRE,
+    COMBAT_EVENT_TRAP_SPAWN,
+    COMBAT_EVENT_TRAP_EXPIRE,
+    COMBAT_EVENT_ROCKET_TRAIL,
+    COMBAT_EVENT_EXPLOSION
+} CombatEventType;
+
+// Efeito colateral de um tick da simulação. Partículas e som ficam com quem
+// consome; a simulação em si não toca em áudio nem em render.
+typedef struct {
+    CombatEventType type;
+    unsigned int tick;
+    Vector2 position;           // centro do alvo atingido / do objeto
+    float rotation;             // só rastro do foguete
+    bool isPlayer1;             // dono do golpe, projétil ou armadilha
+    MoveEffect effect;
+    MoveType moveType;
+    bool hasParticleVisual;     // armadilha desenhada por partículas
+} CombatEvent;
+
 // --- PROTÓTIPOS DE FUNÇÕES ---
 void GameScene_Init(int p1CharacterID, int p2CharacterID);
 int GameScene_Update(void);
 void GameScene_Draw(void);
 void GameScene_Unload(void);
+void GameScene_Prefetch(void);
 void GameScene_SetMultiplayer(bool enabled);
 void GameScene_SetFont(Font font);
 void GameScene_SetMainFont(Font font);
-void GameScene_SetLanguage(int lang);
+void GameScene_SetInputBuffer(int frames);
+void GameScene_SetCPUDifficulty(CPUDifficulty difficulty);
 
 // Sistema de Combate
-void Combat_Init(void);
-void Combat_Update(Player *p1, Player *p2);
-void Combat_Draw(Player *p1, Player *p2, Texture2D poisonTex, Texture2D dnaTex, Texture2D amoebaTex, Texture2D sporeTex);
-void Combat_Cleanup(void);
-void Combat_TryExecuteMove(Player *player, Move *move, bool isPlayer1);
+void Combat_Init(CombatWorld *world);
+void Combat_Clone(CombatWorld *dst, const CombatWorld *src);
+void Combat_Update(CombatWorld *world, Player *p1, Player *p2);
+void Combat_Draw(const CombatWorld *world, Texture2D poisonTex, Texture2D dnaTex, Texture2D amoebaTex);
+void Combat_Cleanup(CombatWorld *world);
+void Combat_TryExecuteMove(CombatWorld *world, Player *player, const Move *move, bool isPlayer1);
 void Combat_ApplyStatus(Player *player, float dt);
-void PlayHurtSound(void);
-void SpawnVfx(Vector2 pos, float rotation, Texture2D tex, int frames, float speed, float scale);
 
-extern Texture2D texHitVfx;
+// Eventos do tick: Combat_BeginTick limpa o buffer. Desligado (execução sem
+// tela, ressimulação, clones da busca) o registro não custa nada além de um teste.
+void Combat_BeginTick(unsigned int tick);
+void Combat_SetEventsEnabled(CombatWorld *world, bool enabled);
+void Combat_EmitEffect(CombatWorld *world, CombatEventType type, Vector2 position, float rotation);
+const CombatEvent *Combat_GetEvents(int *count);
 
 Moveset* LoadMovesetFromJSON(const char *filename);
+void UnloadMoveset(Moveset *moveset);
 
 #endif
\ No newline at end of file
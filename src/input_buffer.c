@@ -0,0 +1,133 @@
+#include "input_buffer.h"
+
+#define KEY_QUEUE_SIZE 16
+
+static int tickKeyQueue[KEY_QUEUE_SIZE];
+static int tickKeyCount = 0;
+
+static unsigned int ReadHeldButtons(const InputConfig *config) {
+    unsigned int held = 0;
+
+    if (IsKeyDown(config->left))    held |= BUTTON_LEFT;
+    if (IsKeyDown(config->right))   held |= BUTTON_RIGHT;
+    if (IsKeyDown(config->up))      held |= BUTTON_UP;
+    if (IsKeyDown(config->down))    held |= BUTTON_DOWN;
+    if (IsKeyDown(config->jump))    held |= BUTTON_JUMP;
+    if (IsKeyDown(config->attack))  held |= BUTTON_ATTACK;
+    if (IsKeyDown(config->special)) held |= BUTTON_SPECIAL;
+
+    return held;
+}
+
+static unsigned int ButtonForKey(const InputConfig *config, KeyboardKey key) {
+    if (key == config->left)    return BUTTON_LEFT;
+    if (key == config->right)   return BUTTON_RIGHT;
+    if (key == config->up)      return BUTTON_UP;
+    if (key == config->down)    return BUTTON_DOWN;
+    if (key == config->jump)    return BUTTON_JUMP;
+    if (key == config->attack)  return BUTTON_ATTACK;
+    if (key == config->special) return BUTTON_SPECIAL;
+    return 0;
+}
+
+static void PushEvent(PlayerInput *input, unsigned int button, bool isPress, unsigned int tick) {
+    InputEvent *event = &input->events[input->head];
+    event->button = button;
+    event->isPress = isPress;
+    event->consumed = false;
+    event->tick = tick;
+    event->time = GetTime();
+
+    input->head = (input->head + 1) % INPUT_RING_SIZE;
+    if (input->count < INPUT_RING_SIZE) input->count++;
+}
+
+// Procura, do mais novo para o mais antigo, um toque ainda não usado dentro da janela
+static int FindPress(const PlayerInput *input, unsigned int button) {
+    for (int i = 0; i < input->count; i++) {
+        int index = (input->head - 1 - i + INPUT_RING_SIZE) % INPUT_RING_SIZE;
+        const InputEvent *event = &input->events[index];
+
+        if (input->frame.tick - event->tick > (unsigned int)input->bufferWindow) break;
+        if (event->button == button && event->isPress && !event->consumed) return index;
+    }
+    return -1;
+}
+
+void Input_Init(PlayerInput *input, InputConfig config, int bufferWindow) {
+    input->config = config;
+    input->frame = (InputFrame){ 0 };
+    input->head = 0;
+    input->count = 0;
+
+    if (bufferWindow < 0) bufferWindow = 0;
+    if (bufferWindow > INPUT_BUFFER_MAX) bufferWindow = INPUT_BUFFER_MAX;
+    input->bufferWindow = bufferWindow;
+}
+
+// Esvazia a fila de teclas do raylib uma vez por tick. Ela guarda toques que
+// começaram e terminaram entre dois polls, que o IsKeyDown não enxerga.
+void Input_BeginTick(void) {
+    tickKeyCount = 0;
+
+    int key = GetKeyPressed();
+    while (key != 0) {
+        if (tickKeyCount < KEY_QUEUE_SIZE) tickKeyQueue[tickKeyCount++] = key;
+        key = GetKeyPressed();
+    }
+}
+
+void Input_Capture(PlayerInput *input, unsigned int tick) {
+    unsigned int held = ReadHeldButtons(&input->config);
+    unsigned int tapped = 0;
+
+    for (int i = 0; i < tickKeyCount; i++) {
+        tapped |= ButtonForKey(&input->config, (KeyboardKey)tickKeyQueue[i]);
+    }
+
+    Input_Feed(input, held, tapped, tick);
+}
+
+// Ponto de entrada comum para teclado, replay e rede: só o estado por tick
+void Input_Feed(PlayerInput *input, unsigned int held, unsigned int tapped, unsigned int tick) {
+    unsigned int previous = input->frame.held;
+    unsigned int pressed = (held & ~previous) | tapped;
+    unsigned int released = (previous & ~held) | (tapped & ~held);
+
+    for (int i = 0; i < INPUT_BUTTON_COUNT; i++) {
+        unsigned int button = 1u << i;
+        if (pressed & button) PushEvent(input, button, true, tick);
+        if (released & button) PushEvent(input, button, false, tick);
+    }
+
+    input->frame.held = held;
+    input->frame.pressed = pressed;
+    input->frame.released = released;
+    input->frame.tick = tick;
+}
+
+// Descarta o histórico (ex.: ao sair da pausa). Teclas que continuam
+// pressionadas passam a contar como seguradas, não como toques novos.
+void Input_Flush(PlayerInput *input) {
+    input->head = 0;
+    input->count = 0;
+    input->frame.held = ReadHeldButtons(&input->config);
+    input->frame.pressed = 0;
+    input->frame.released = 0;
+}
+
+bool Input_IsHeld(const PlayerInput *input, InputButton button) {
+    return (input->frame.held & button) != 0;
+}
+
+bool Input_HasPress(const PlayerInput *input, InputButton button) {
+    return FindPress(input, button) >= 0;
+}
+
+bool Input_TakePress(PlayerInput *input, InputButton button) {
+    int index = FindPress(input, button);
+    if (index < 0) return false;
+
+    input->events[index].consumed = true;
+    return true;
+}
@@ -0,0 +1,65 @@
+#ifndef INPUT_BUFFER_H
+#define INPUT_BUFFER_H
+
+#include "raylib.h"
+#include "game_scene.h"
+
+#define INPUT_RING_SIZE 64
+#define INPUT_BUFFER_DEFAULT 5
+#define INPUT_BUFFER_MAX 10
+
+// --- ENUMS ---
+
+typedef enum {
+    BUTTON_LEFT    = 1 << 0,
+    BUTTON_RIGHT   = 1 << 1,
+    BUTTON_UP      = 1 << 2,
+    BUTTON_DOWN    = 1 << 3,
+    BUTTON_JUMP    = 1 << 4,
+    BUTTON_ATTACK  = 1 << 5,
+    BUTTON_SPECIAL = 1 << 6
+} InputButton;
+
+#define INPUT_BUTTON_COUNT 7
+
+// --- STRUCTS ---
+
+typedef struct {
+    unsigned int button;
+    bool isPress;
+    bool consumed;
+    unsigned int tick;
+    double time;
+} InputEvent;
+
+// Estado dos botões em um tick da simulação: é tudo que o sim lê
+typedef struct {
+    unsigned int held;
+    unsigned int pressed;
+    unsigned int released;
+    unsigned int tick;
+} InputFrame;
+
+typedef struct {
+    InputConfig config;
+    InputFrame frame;
+
+    InputEvent events[INPUT_RING_SIZE];
+    int head;
+    int count;
+
+    int bufferWindow;
+} PlayerInput;
+
+// --- PROTÓTIPOS DE FUNÇÕES ---
+void Input_Init(PlayerInput *input, InputConfig config, int bufferWindow);
+void Input_BeginTick(void);
+void Input_Capture(PlayerInput *input, unsigned int tick);
+void Input_Feed(PlayerInput *input, unsigned int held, unsigned int tapped, unsigned int tick);
+void Input_Flush(PlayerInput *input);
+
+bool Input_IsHeld(const PlayerInput *input, InputButton button);
+bool Input_HasPress(const PlayerInput *input, InputButton button);
+bool Input_TakePress(PlayerInput *input, InputButton button);
+
+#endif
@@ -0,0 +1,228 @@
+#include "localization.h"
+#include "custom_fonts.h"
+#include <stdio.h>
+
+static const char *stringTable[LANG_COUNT][STR_COUNT] = {
+    [LANG_EN] = {
+        [STR_MENU_QUICKPLAY] = "Quick Play",
+        [STR_MENU_ARCADE] = "Arcade",
+        [STR_MENU_EXTRAS] = "Extras",
+        [STR_MENU_SETTINGS] = "Settings",
+        [STR_MENU_QUIT] = "Quit Game",
+
+        [STR_QP_TITLE] = "GAME MODE",
+        [STR_QP_SINGLEPLAYER] = "Singleplayer",
+        [STR_QP_MULTIPLAYER] = "Multiplayer",
+        [STR_QP_RETURN] = "Return",
+
+        [STR_SETTINGS_TITLE] = "Settings",
+        [STR_SETTINGS_MASTER_VOLUME] = "Master Volume",
+        [STR_SETTINGS_MUSIC] = "Music",
+        [STR_SETTINGS_SFX] = "SFX",
+        [STR_SETTINGS_RESOLUTION] = "Resolution",
+        [STR_SETTINGS_FULLSCREEN] = "Fullscreen",
+        [STR_SETTINGS_LANGUAGE] = "Language: ENG",
+        [STR_SETTINGS_PRESENTATION] = "Presentation",
+        [STR_SETTINGS_INPUT_BUFFER] = "Input Buffer",
+        [STR_SETTINGS_CPU_DIFFICULTY] = "CPU Difficulty",
+        [STR_SETTINGS_CREDITS] = "Credits",
+        [STR_SETTINGS_RETURN] = "Return",
+        [STR_SETTINGS_BUFFER_VALUE] = "< %d frames >",
+
+        [STR_PRESENT_VSYNC] = "VSync",
+        [STR_PRESENT_UNCAPPED] = "Uncapped",
+        [STR_PRESENT_LOW_LATENCY] = "Low Latency",
+
+        [STR_CPU_EASY] = "Easy",
+        [STR_CPU_NORMAL] = "Normal",
+        [STR_CPU_HARD] = "Hard",
+
+        [STR_CREDITS_TITLE] = "CREDITS",
+        [STR_CREDITS_SPECIAL_THANKS] = "Special Thanks",
+        [STR_PRESS_ENTER_RETURN] = "Press ENTER to Return",
+
+        [STR_CSS_TITLE] = "SELECT YOUR MICROBE",
+        [STR_CSS_P1_CHOOSE] = "P1: CHOOSE CHARACTER",
+        [STR_CSS_P2_CHOOSE] = "P2: CHOOSE CHARACTER",
+        [STR_STAT_HP] = "HP:",
+        [STR_STAT_STR] = "STR:",
+        [STR_STAT_SPD] = "SPD:",
+        [STR_STAT_LOW] = "LOW",
+        [STR_STAT_MED] = "MED",
+        [STR_STAT_HIGH] = "HIGH",
+
+        [STR_CHAR_BACTERIOPHAGE] = "BACTERIOPHAGE",
+        [STR_CHAR_AMOEBA] = "AMOEBA",
+        [STR_CHAR_TARDIGRADE] = "TARDIGRADE",
+        [STR_CHAR_STENTOR] = "STENTOR",
+        [STR_CHAR_PARAMECIUM] = "PARAMECIUM",
+        [STR_CHAR_EUGLENA] = "EUGLENA",
+        [STR_CHAR_NEMATODE] = "NEMATODE",
+        [STR_CHAR_ROTIFER] = "ROTIFER",
+        [STR_CHAR_DINOFLAGELLATE] = "DINOFLAGELLATE",
+        [STR_CHAR_DAPHNIA] = "DAPHNIA",
+        [STR_CHAR_HYDRA] = "HYDRA",
+        [STR_CHAR_ARCHEON] = "ARCHEON",
+        [STR_CHAR_UNKNOWN] = "UNKNOWN",
+
+        [STR_DEMO_LOCK] =
+            "Buy an official copy of Micro Mayhem to\nenjoy everything!\n\n"
+            "+ 10 unique characters!\n"
+            "+ 1 Story Mode (Arcade)!\n"
+            "+ Extras (Concept Art & Gallery!)\n"
+            "+ More ambitious settings!\n"
+            "+ Improved CPU AI!\n"
+            "+ New Micro-Environments!\n"
+            "+ MUCH MORE!\n\n"
+            "For now, this feature is not available\nin the demo!",
+
+        [STR_FIGHT] = "FIGHT!",
+        [STR_P1_WINS] = "PLAYER 1 WINS!",
+        [STR_P2_WINS] = "PLAYER 2 WINS!",
+        [STR_PAUSED] = "PAUSED",
+        [STR_PAUSE_RESUME] = "RESUME",
+        [STR_PAUSE_SETTINGS] = "SETTINGS",
+        [STR_PAUSE_QUIT] = "QUIT MATCH",
+    },
+    [LANG_PT] = {
+        [STR_MENU_QUICKPLAY] = "Jogo Rápido",
+        [STR_MENU_ARCADE] = "Arcade",
+        [STR_MENU_EXTRAS] = "Extras",
+        [STR_MENU_SETTINGS] = "Opções",
+        [STR_MENU_QUIT] = "Sair",
+
+        [STR_QP_TITLE] = "MODO DE JOGO",
+        [STR_QP_SINGLEPLAYER] = "Um Jogador",
+        [STR_QP_MULTIPLAYER] = "Multijogador",
+        [STR_QP_RETURN] = "Voltar",
+
+        [STR_SETTINGS_TITLE] = "Configurações",
+        [STR_SETTINGS_MASTER_VOLUME] = "Volume Geral",
+        [STR_SETTINGS_MUSIC] = "Música",
+        [STR_SETTINGS_SFX] = "Efeitos (SFX)",
+        [STR_SETTINGS_RESOLUTION] = "Resolução",
+        [STR_SETTINGS_FULLSCREEN] = "Tela Cheia",
+        [STR_SETTINGS_LANGUAGE] = "Idioma: PT-BR",
+        [STR_SETTINGS_PRESENTATION] = "Apresentação",
+        [STR_SETTINGS_INPUT_BUFFER] = "Buffer de Entrada",
+        [STR_SETTINGS_CPU_DIFFICULTY] = "Dificuldade da CPU",
+        [STR_SETTINGS_CREDITS] = "Créditos",
+        [STR_SETTINGS_RETURN] = "Voltar",
+        [STR_SETTINGS_BUFFER_VALUE] = "< %d quadros >",
+
+        [STR_PRESENT_VSYNC] = "VSync",
+        [STR_PRESENT_UNCAPPED] = "Sem Limite",
+        [STR_PRESENT_LOW_LATENCY] = "Baixa Latência",
+
+        [STR_CPU_EASY] = "Fácil",
+        [STR_CPU_NORMAL] = "Normal",
+        [STR_CPU_HARD] = "Difícil",
+
+        [STR_CREDITS_TITLE] = "CREDITOS",
+        [STR_CREDITS_SPECIAL_THANKS] = "Agradecimentos Especiais",
+        [STR_PRESS_ENTER_RETURN] = "Pressione ENTER para Voltar",
+
+        [STR_CSS_TITLE] = "SELECIONE SEU MICROBIO",
+        [STR_CSS_P1_CHOOSE] = "P1: ESCOLHA O PERSONAGEM",
+        [STR_CSS_P2_CHOOSE] = "P2: ESCOLHA O PERSONAGEM",
+        [STR_STAT_HP] = "HP:",
+        [STR_STAT_STR] = "FOR:",
+        [STR_STAT_SPD] = "VEL:",
+        [STR_STAT_LOW] = "BAIXO",
+        [STR_STAT_MED] = "MEDIO",
+        [STR_STAT_HIGH] = "ALTO",
+
+        [STR_CHAR_BACTERIOPHAGE] = "BACTERIOFAGO",
+        [STR_CHAR_AMOEBA] = "AMEBA",
+        [STR_CHAR_TARDIGRADE] = "TARDIGRADO",
+        [STR_CHAR_STENTOR] = "STENTOR",
+        [STR_CHAR_PARAMECIUM] = "PARAMECIO",
+        [STR_CHAR_EUGLENA] = "EUGLENA",
+        [STR_CHAR_NEMATODE] = "NEMATODEO",
+        [STR_CHAR_ROTIFER] = "ROTIFERO",
+        [STR_CHAR_DINOFLAGELLATE] = "DINOFLAGELADO",
+        [STR_CHAR_DAPHNIA] = "DAPHNIA",
+        [STR_CHAR_HYDRA] = "HIDRA",
+        [STR_CHAR_ARCHEON] = "ARQUEA",
+        [STR_CHAR_UNKNOWN] = "DESCONHECIDO",
+
+        [STR_DEMO_LOCK] =
+            "Compre uma cópia oficial de Micro Mayhem para\naproveitar tudo!\n\n"
+            "+ 10 personagens únicos!\n"
+            "+ 1 modo história (arcade)!\n"
+            "+ Extras (arte conceitual e galeria!)\n"
+            "+ Configurações mais ambiciosas!\n"
+            "+ CPU melhorada!\n"
+            "+ Novos microambientes!\n"
+            "+ MUITO MAIS!\n\n"
+            "Por enquanto, esse recurso não está\ndisponível na demo!",
+
+        [STR_FIGHT] = "LUTEM!",
+        [STR_P1_WINS] = "JOGADOR 1 VENCEU!",
+        [STR_P2_WINS] = "JOGADOR 2 VENCEU!",
+        [STR_PAUSED] = "PAUSA",
+        [STR_PAUSE_RESUME] = "CONTINUAR",
+        [STR_PAUSE_SETTINGS] = "CONFIGURACOES",
+        [STR_PAUSE_QUIT] = "SAIR DA PARTIDA",
+    }
+};
+
+static GameLanguage currentLanguage = LANG_EN;
+static Font registeredFonts[LOC_MAX_FONTS];
+static int registeredFontCount = 0;
+
+// Medidas independentes do tamanho: Loc_Measure só escala, nunca percorre o texto
+static TextMetrics stringMetrics[LOC_MAX_FONTS][STR_COUNT];
+
+static void MeasureFontStrings(int fontIndex) {
+    for (int id = 0; id < STR_COUNT; id++) {
+        stringMetrics[fontIndex][id] = MeasureTextMetrics(registeredFonts[fontIndex], Loc_Get(id));
+    }
+}
+
+void Loc_RegisterFont(Font font) {
+    if (registeredFontCount >= LOC_MAX_FONTS) {
+        printf("LOC: Limite de fontes atingido\n");
+        return;
+    }
+
+    registeredFonts[registeredFontCount] = font;
+    MeasureFontStrings(registeredFontCount);
+    registeredFontCount++;
+}
+
+void Loc_SetLanguage(GameLanguage language) {
+    if (language < 0 || language >= LANG_COUNT) language = LANG_EN;
+    if (language == currentLanguage) return;
+
+    currentLanguage = language;
+    for (int i = 0; i < registeredFontCount; i++) {
+        MeasureFontStrings(i);
+    }
+}
+
+GameLanguage Loc_GetLanguage(void) {
+    return currentLanguage;
+}
+
+const char *Loc_Get(StringID id) {
+    const char *text = stringTable[currentLanguage][id];
+
+    // Tradução faltando: usa o inglês
+    if (text == NULL) text = stringTable[LANG_EN][id];
+    return (text != NULL) ? text : "";
+}
+
+const char *Loc_GetCharacterName(int charID) {
+    if (charID < 0 || charID >= LOC_CHARACTER_COUNT) return Loc_Get(STR_CHAR_UNKNOWN);
+    return Loc_Get(STR_CHAR_BACTERIOPHAGE + charID);
+}
+
+Vector2 Loc_Measure(StringID id, Font font, float fontSize, float spacing) {
+    for (int i = 0; i < registeredFontCount; i++) {
+        if (registeredFonts[i].texture.id == font.texture.id) {
+            return ScaleTextMetrics(stringMetrics[i][id], font, fontSize, spacing);
+        }
+    }
+    return MeasureTextCached(font, Loc_Get(id), fontSize, spacing);
+}
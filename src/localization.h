@@ -0,0 +1,98 @@
+#ifndef LOCALIZATION_H
+#define LOCALIZATION_H
+
+#include "raylib.h"
+#include "game_scene.h"
+
+#define LOC_MAX_FONTS 4
+#define LOC_CHARACTER_COUNT 12
+
+// --- ENUMS ---
+
+// Blocos contíguos (menu, opções, status, personagens) podem ser indexados
+// somando o índice ao primeiro ID do bloco.
+typedef enum {
+    STR_MENU_QUICKPLAY,
+    STR_MENU_ARCADE,
+    STR_MENU_EXTRAS,
+    STR_MENU_SETTINGS,
+    STR_MENU_QUIT,
+
+    STR_QP_TITLE,
+    STR_QP_SINGLEPLAYER,
+    STR_QP_MULTIPLAYER,
+    STR_QP_RETURN,
+
+    STR_SETTINGS_TITLE,
+    STR_SETTINGS_MASTER_VOLUME,
+    STR_SETTINGS_MUSIC,
+    STR_SETTINGS_SFX,
+    STR_SETTINGS_RESOLUTION,
+    STR_SETTINGS_FULLSCREEN,
+    STR_SETTINGS_LANGUAGE,
+    STR_SETTINGS_PRESENTATION,
+    STR_SETTINGS_INPUT_BUFFER,
+    STR_SETTINGS_CPU_DIFFICULTY,
+    STR_SETTINGS_CREDITS,
+    STR_SETTINGS_RETURN,
+    STR_SETTINGS_BUFFER_VALUE,
+
+    STR_PRESENT_VSYNC,
+    STR_PRESENT_UNCAPPED,
+    STR_PRESENT_LOW_LATENCY,
+
+    STR_CPU_EASY,
+    STR_CPU_NORMAL,
+    STR_CPU_HARD,
+
+    STR_CREDITS_TITLE,
+    STR_CREDITS_SPECIAL_THANKS,
+    STR_PRESS_ENTER_RETURN,
+
+    STR_CSS_TITLE,
+    STR_CSS_P1_CHOOSE,
+    STR_CSS_P2_CHOOSE,
+    STR_STAT_HP,
+    STR_STAT_STR,
+    STR_STAT_SPD,
+    STR_STAT_LOW,
+    STR_STAT_MED,
+    STR_STAT_HIGH,
+
+    STR_CHAR_BACTERIOPHAGE,
+    STR_CHAR_AMOEBA,
+    STR_CHAR_TARDIGRADE,
+    STR_CHAR_STENTOR,
+    STR_CHAR_PARAMECIUM,
+    STR_CHAR_EUGLENA,
+    STR_CHAR_NEMATODE,
+    STR_CHAR_ROTIFER,
+    STR_CHAR_DINOFLAGELLATE,
+    STR_CHAR_DAPHNIA,
+    STR_CHAR_HYDRA,
+    STR_CHAR_ARCHEON,
+    STR_CHAR_UNKNOWN,
+
+    STR_DEMO_LOCK,
+
+    STR_FIGHT,
+    STR_P1_WINS,
+    STR_P2_WINS,
+    STR_PAUSED,
+    STR_PAUSE_RESUME,
+    STR_PAUSE_SETTINGS,
+    STR_PAUSE_QUIT,
+
+    STR_COUNT
+} StringID;
+
+// --- PROTÓTIPOS DE FUNÇÕES ---
+void Loc_RegisterFont(Font font);
+void Loc_SetLanguage(GameLanguage language);
+GameLanguage Loc_GetLanguage(void);
+
+const char *Loc_Get(StringID id);
+const char *Loc_GetCharacterName(int charID);
+Vector2 Loc_Measure(StringID id, Font font, float fontSize, float spacing);
+
+#endif
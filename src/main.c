@@ -4,14 +4,27 @@
 #include <stdio.h>
 #include "game_scene.h"
 #include "custom_fonts.h"
+#include "render_scale.h"
+#include "frame_pacing.h"
+#include "input_buffer.h"
+#include "localization.h"
+#include "asset_loader.h"
+#include "texture_stream.h"
+#include "resource_set.h"
+#include "scene_stack.h"
+#include "music_player.h"
+#include "sound_pool.h"
+#include "character_registry.h"
 
 #define MENU_OPTIONS 5
 #define QP_OPTIONS 3
 #define BG_COUNT 20
 #define UNIQUE_BG_COUNT 18
-#define SETTINGS_OPTIONS 8
+#define SETTINGS_OPTIONS 11
 #define CHAR_COUNT 12
 #define CONFIG_FILE "game_settings.bin"
+#define TEXTURE_DECODE_THREADS 3
+#define TEXTURE_UPLOAD_BUDGET 0.004
 
 typedef enum {
     STATE_SPLASH_FADE_IN,
@@ -29,21 +42,19 @@ typedef enum {
 } GameState;
 
 typedef struct {
-    Texture2D texture;
+    const Texture2D *texture;
     Vector2 positionRatio;
     float scale;
 } TitleBG;
 
-void LoadTexturesInLoop(Texture2D textures[], const char *paths[], int count) {
-    for (int i = 0; i < count; i++) {
-        textures[i] = LoadTexture(paths[i]);
-    }
+unsigned int HashFrameValue(unsigned int hash, int value) {
+    return (hash ^ (unsigned int)value) * 16777619u;
 }
 
-void UnloadTexturesInLoop(Texture2D textures[], int count) {
-    for (int i = 0; i < count; i++) {
-        UnloadTexture(textures[i]);
-    }
+unsigned int HashFrameBytes(unsigned int hash, const void *data, int size) {
+    const unsigned char *bytes = (const unsigned char *)data;
+    for (int i = 0; i < size; i++) hash = (hash ^ bytes[i]) * 16777619u;
+    return hash;
 }
 
 void DrawRadialBackground(int screenWidth, int screenHeight);
@@ -80,17 +91,6 @@ const char *TitleBGPaths[UNIQUE_BG_COUNT] = {
 };
 
 bool isMultiplayer = false;
-const char* charNamesEN[CHAR_COUNT] = { 
-    "BACTERIOPHAGE", "AMOEBA", "TARDIGRADE", "STENTOR", 
-    "PARAMECIUM", "EUGLENA", "NEMATODE", "ROTIFER",
-    "DINOFLAGELLATE", "DAPHNIA", "HYDRA", "ARCHEON" 
-};
-
-const char* charNamesPT[CHAR_COUNT] = { 
-    "BACTERIOFAGO", "AMEBA", "TARDIGRADO", "STENTOR", 
-    "PARAMECIO", "EUGLENA", "NEMATODEO", "ROTIFERO",
-    "DINOFLAGELADO", "DAPHNIA", "HIDRA", "ARQUEA" 
-};
 int p1Selection = 0;
 int p2Selection = 0;
 bool isSelectingP2 = false;
@@ -103,6 +103,108 @@ int statsSPD[CHAR_COUNT]   = { 2, 1, 0, 1, 2, 0, 1, 1, 0, 2, 1, 2 };
 const char* statLabels[] = { "LOW", "MED", "HIGH" };
 Color statColors[] = { RED, YELLOW, GREEN };
 
+// =========================================================
+// CENAS: CADA UMA CARREGA E DESCARREGA AS PRÓPRIAS TEXTURAS
+// =========================================================
+const char *MenuIconPaths[MENU_OPTIONS] = {
+    "assets/QP_icon.png",
+    "assets/Arcade_icon.png",
+    "assets/Extras_icon.png",
+    "assets/Settings_icon.png",
+    "assets/QG_icon.png"
+};
+
+Texture2D cesarLogo;
+Texture2D mmLogo;
+Texture2D uniqueTitleBGs[UNIQUE_BG_COUNT];
+Texture2D menuIcons[MENU_OPTIONS];
+Texture2D qpIcons[2];
+Texture2D boxArtTex;
+Texture2D charSelectBg, charBoxTex, lockedBoxTex, infoBoxTex, bactIcon, amoebaIcon;
+
+ResourceSet splashResources = { .name = "splash" };
+ResourceSet frontendResources = { .name = "frontend" };
+ResourceSet characterSelectResources = { .name = "character_select" };
+
+void BuildSceneResources(void) {
+    const int keep = TEXTURE_STREAM_KEEP;
+
+    ResourceSet_AddTexture(&splashResources, &cesarLogo, "assets/cesar_logo.png", keep, keep);
+
+    ResourceSet_AddTexture(&frontendResources, &mmLogo, "assets/title.png", keep, keep);
+    for (int i = 0; i < UNIQUE_BG_COUNT; i++) {
+        ResourceSet_AddTexture(&frontendResources, &uniqueTitleBGs[i], TitleBGPaths[i], keep, keep);
+    }
+    for (int i = 0; i < MENU_OPTIONS; i++) {
+        ResourceSet_AddTexture(&frontendResources, &menuIcons[i], MenuIconPaths[i], TEXTURE_FILTER_POINT, TEXTURE_WRAP_CLAMP);
+    }
+    ResourceSet_AddTexture(&frontendResources, &qpIcons[0], "assets/SP_icon.png", TEXTURE_FILTER_POINT, TEXTURE_WRAP_CLAMP);
+    ResourceSet_AddTexture(&frontendResources, &qpIcons[1], "assets/MP_icon.png", TEXTURE_FILTER_POINT, TEXTURE_WRAP_CLAMP);
+    ResourceSet_AddTexture(&frontendResources, &boxArtTex, "assets/boxart.png", keep, keep);
+
+    ResourceSet_AddTexture(&characterSelectResources, &charSelectBg, "assets/css_bg.png", TEXTURE_FILTER_POINT, keep);
+    ResourceSet_AddTexture(&characterSelectResources, &charBoxTex, "assets/character_box.png", TEXTURE_FILTER_POINT, keep);
+    ResourceSet_AddTexture(&characterSelectResources, &lockedBoxTex, "assets/locked_character_box.png", TEXTURE_FILTER_POINT, keep);
+    ResourceSet_AddTexture(&characterSelectResources, &infoBoxTex, "assets/infobox.png", TEXTURE_FILTER_POINT, keep);
+    ResourceSet_AddTexture(&characterSelectResources, &bactIcon, "assets/bacteriophage_icon.png", TEXTURE_FILTER_POINT, keep);
+    ResourceSet_AddTexture(&characterSelectResources, &amoebaIcon, "assets/amoeba_icon.png", TEXTURE_FILTER_POINT, keep);
+}
+
+void LoadSplashScene(void) { ResourceSet_Finish(&splashResources); }
+void UnloadSplashScene(void) { ResourceSet_Release(&splashResources); }
+
+void LoadFrontendScene(void) { ResourceSet_Finish(&frontendResources); }
+void UnloadFrontendScene(void) { ResourceSet_Release(&frontendResources); }
+void PrefetchFrontendScene(void) { ResourceSet_Request(&frontendResources, RESOURCE_PRIORITY_PREFETCH); }
+
+void LoadCharacterSelectScene(void) { ResourceSet_Finish(&characterSelectResources); }
+void UnloadCharacterSelectScene(void) { ResourceSet_Release(&characterSelectResources); }
+void PrefetchCharacterSelectScene(void) { ResourceSet_Request(&characterSelectResources, RESOURCE_PRIORITY_PREFETCH); }
+
+// O menu fica na pilha durante a seleção e a luta, mas suspenso e sem texturas
+const Scene splashScene = { "splash", true, LoadSplashScene, UnloadSplashScene, NULL, NULL, NULL };
+const Scene frontendScene = { "frontend", false, LoadFrontendScene, UnloadFrontendScene, UnloadFrontendScene, LoadFrontendScene, PrefetchFrontendScene };
+const Scene characterSelectScene = { "character_select", true, LoadCharacterSelectScene, UnloadCharacterSelectScene, NULL, NULL, PrefetchCharacterSelectScene };
+const Scene gameplayScene = { "gameplay", true, NULL, GameScene_Unload, NULL, NULL, GameScene_Prefetch };
+
+// NULL: a tela roda por cima da cena atual (configurações, créditos)
+const Scene *GetSceneForState(GameState state) {
+    switch (state) {
+        case STATE_SPLASH_FADE_IN:
+        case STATE_SPLASH_CESAR:
+        case STATE_FADE_OUT:
+            return &splashScene;
+        case STATE_REVEAL_MM:
+        case STATE_TITLE_MM:
+        case STATE_MENU:
+        case STATE_QUICKPLAY_MENU:
+        case STATE_DEMO_LOCK:
+            return &frontendScene;
+        case STATE_CHARACTER_SELECT:
+            return &characterSelectScene;
+        case STATE_GAMEPLAY:
+            return &gameplayScene;
+        default:
+            return NULL;
+    }
+}
+
+// Cena que provavelmente vem a seguir, para ir decodificando enquanto esta roda
+const Scene *GetNextSceneForState(GameState state) {
+    switch (state) {
+        case STATE_SPLASH_FADE_IN:
+        case STATE_SPLASH_CESAR:
+        case STATE_FADE_OUT:
+            return &frontendScene;
+        case STATE_QUICKPLAY_MENU:
+            return &characterSelectScene;
+        case STATE_CHARACTER_SELECT:
+            return &gameplayScene;
+        default:
+            return NULL;
+    }
+}
+
 int main(void) {
     // =========================================================
     // 1. INICIALIZAÇÃO DO SISTEMA E JANELA
@@ -115,7 +217,10 @@ int main(void) {
         1.0f, 1.0f, 1.0f,
         0,
         false,
-        LANG_EN
+        LANG_EN,
+        PRESENT_VSYNC,
+        INPUT_BUFFER_DEFAULT,
+        CPU_DIFFICULTY_NORMAL
     };
 
     LoadGameSettings(&settings);
@@ -124,21 +229,54 @@ int main(void) {
         settings.resolutionIndex = 0;
     }
     if (settings.masterVolume < 0) settings.masterVolume = 0.5f;
+    if (settings.language < 0 || settings.language >= LANG_COUNT) {
+        settings.language = LANG_EN;
+    }
+    if (settings.presentMode < 0 || settings.presentMode >= PRESENT_MODE_COUNT) {
+        settings.presentMode = PRESENT_VSYNC;
+    }
+    if (settings.inputBufferFrames < 0 || settings.inputBufferFrames > INPUT_BUFFER_MAX) {
+        settings.inputBufferFrames = INPUT_BUFFER_DEFAULT;
+    }
+    GameScene_SetInputBuffer(settings.inputBufferFrames);
+    if (settings.cpuDifficulty < 0 || settings.cpuDifficulty >= CPU_DIFFICULTY_COUNT) {
+        settings.cpuDifficulty = CPU_DIFFICULTY_NORMAL;
+    }
+    GameScene_SetCPUDifficulty(settings.cpuDifficulty);
 
     int screenWidth = resWidths[settings.resolutionIndex];
     int screenHeight = resHeights[settings.resolutionIndex];
 
     InitWindow(screenWidth, screenHeight, "Micro Mayhem");
+
+    // Sem o pacote (ex.: rodando direto do repositório) lê os arquivos soltos
+    Assets_OpenPack("assets.pak");
     
     if (settings.fullscreen) {
         ToggleFullscreen();
     }
 
-    SetTargetFPS(60);
+    FramePacer pacer;
+    FramePacing_Init(&pacer, settings.presentMode);
     
-    Image icon = LoadImage("assets/exe_icon.png");
+    Image icon = Assets_LoadImage("assets/exe_icon.png");
     SetWindowIcon(icon);
 
+    // =========================================================
+    // 1.1 TEXTURAS: DECODIFICAÇÃO EM SEGUNDO PLANO
+    // =========================================================
+    // Os PNGs decodificam enquanto áudio e shaders inicializam; o upload
+    // acontece entre frames e cada cena só espera pelas próprias texturas
+    TextureStream_Init(TEXTURE_DECODE_THREADS);
+
+    Texture2D gameFontTex, mainFontTex;
+    TextureStream_Request(&gameFontTex, "assets/game_font.png", RESOURCE_PRIORITY_NOW, TEXTURE_STREAM_KEEP, TEXTURE_STREAM_KEEP);
+    TextureStream_Request(&mainFontTex, "assets/main_font.png", RESOURCE_PRIORITY_NOW, TEXTURE_STREAM_KEEP, TEXTURE_STREAM_KEEP);
+
+    BuildSceneResources();
+    ResourceSet_Request(&splashResources, RESOURCE_PRIORITY_NOW);
+    SceneStack_Prefetch(&frontendScene);
+
     // =========================================================
     // 2. SISTEMA DE ÁUDIO
     // =========================================================
@@ -146,19 +284,16 @@ int main(void) {
     
     SetMasterVolume(settings.masterVolume);
     
-    Music menuMusic = LoadMusicStream("assets/audio/main_menu.ogg");
-    menuMusic.looping = true;
-    SetMusicVolume(menuMusic, settings.musicVolume); 
-    bool isMenuMusicPlaying = false;
+    // As músicas são decodificadas numa thread própria, fora do ritmo dos frames
+    MusicPlayer_Init();
+    MusicPlayer_SetVolume(settings.musicVolume);
 
-    Sound sndSelect = LoadSound("assets/audio/select.mp3");
-    Sound sndSelected = LoadSound("assets/audio/confirm.mp3");
+    int menuMusic = MusicPlayer_Load("assets/audio/main_menu.ogg", true);
+    int cssMusic = MusicPlayer_Load("assets/audio/css_music.ogg", true);
+    int fightMusic = MusicPlayer_Load("assets/audio/fight.ogg", true);
 
-    Music cssMusic = LoadMusicStream("assets/audio/css_music.ogg");
-    cssMusic.looping = true;
-
-    Music fightMusic = LoadMusicStream("assets/audio/fight.ogg");
-    fightMusic.looping = true;
+    Sound sndSelect = Assets_LoadSound("assets/audio/select.mp3");
+    Sound sndSelected = Assets_LoadSound("assets/audio/confirm.mp3");
 
     // =========================================================
     // 3. SHADERS E RENDER TEXTURE (SISTEMA VISUAL)
@@ -166,14 +301,17 @@ int main(void) {
     RenderTexture2D target = LoadRenderTexture(GAME_WIDTH, GAME_HEIGHT);
     SetTextureFilter(target.texture, TEXTURE_FILTER_POINT); 
 
-    Shader pixelShader = LoadShader(0, "assets/shaders/pixelizer.fs");
+    RenderScaleController renderScale;
+    RenderScale_Init(&renderScale, GAME_WIDTH, GAME_HEIGHT);
+
+    Shader pixelShader = Assets_LoadShader("assets/shaders/pixelizer.fs");
     int pixelSizeLoc = GetShaderLocation(pixelShader, "pixelSize");
     int renderSizeLoc = GetShaderLocation(pixelShader, "renderSize");
     float renderSize[2] = { (float)GAME_WIDTH, (float)GAME_HEIGHT };
     SetShaderValue(pixelShader, renderSizeLoc, renderSize, SHADER_UNIFORM_VEC2);
     float currentPixelSize = 20.0f;
 
-    Shader gradientShader = LoadShader(0, "assets/shaders/radial_gradient.fs");
+    Shader gradientShader = Assets_LoadShader("assets/shaders/radial_gradient.fs");
     int resLoc = GetShaderLocation(gradientShader, "resolution");
     int centerLoc = GetShaderLocation(gradientShader, "colorCenter");
     int edgeLoc = GetShaderLocation(gradientShader, "colorEdge");
@@ -184,75 +322,54 @@ int main(void) {
     // =========================================================
     // 4. ASSETS: LOGOS E FONTES
     // =========================================================
-    Texture2D cesarLogo = LoadTexture("assets/cesar_logo.png");
-    Texture2D mmLogo = LoadTexture("assets/title.png");
-    
-    Font gameFont = LoadGameFont("assets/game_font.png");
-    Font mainFont = LoadMainFont("assets/main_font.png");
+    // Só a logo da splash e as fontes precisam estar prontas antes do primeiro frame
+    TextureStream_Finish(RESOURCE_PRIORITY_NOW);
+    SceneStack_Goto(&splashScene);
+
+    Font gameFont = LoadGameFont(gameFontTex);
+    Font mainFont = LoadMainFont(mainFontTex);
     GameScene_SetFont(gameFont);
     GameScene_SetMainFont(mainFont);
 
+    Loc_SetLanguage(settings.language);
+    Loc_RegisterFont(mainFont);
+    Loc_RegisterFont(gameFont);
+
     // =========================================================
     // 5. ASSETS: BACKGROUNDS (ARRAYS E CARREGAMENTO)
     // =========================================================
-    Texture2D uniqueTitleBGs[UNIQUE_BG_COUNT];
-    LoadTexturesInLoop(uniqueTitleBGs, TitleBGPaths, UNIQUE_BG_COUNT);
-
     TitleBG titleBGs[BG_COUNT] = {
-        { uniqueTitleBGs[0], {0.34f, 0.195f}, 2.6f },
-        { uniqueTitleBGs[1], {0.35f, 0.79f}, 3.0f },
-        { uniqueTitleBGs[2], {0.8f, 0.36f}, 2.7f },
-        { uniqueTitleBGs[3], {0.56f, 0.17f}, 2.7f },
-        { uniqueTitleBGs[4], {0.73f, 0.18f}, 2.5f },
-        { uniqueTitleBGs[5], {0.39f, 0.79f}, 3.0f },
-        { uniqueTitleBGs[6], {0.88f, 0.83f}, 2.5f },
-        { uniqueTitleBGs[7], {0.88f, 0.26f}, 2.9f },
-        { uniqueTitleBGs[8], {0.125f, 0.72f}, 2.7f },
-        { uniqueTitleBGs[9], {0.16f, 0.17f}, 2.7f },
-        { uniqueTitleBGs[10], {0.12f, 0.42f}, 2.8f },
-        { uniqueTitleBGs[11], {0.28f, 0.77f}, 2.7f },
-        { uniqueTitleBGs[12], {0.67f, 0.81f}, 2.8f },
-        { uniqueTitleBGs[13], {0.895f, 0.47f}, 2.8f },
-        { uniqueTitleBGs[14], {0.21f, 0.82f}, 2.5f },
-        { uniqueTitleBGs[15], {0.86f, 0.47f}, 2.8f },
-        { uniqueTitleBGs[15], {0.825f, 0.47f}, 2.8f }, 
-        { uniqueTitleBGs[16], {0.615f, 0.82f}, 2.2f },
-        { uniqueTitleBGs[17], {0.22f, 0.35f}, 1.6f }, 
-        { uniqueTitleBGs[17], {0.78f, 0.72f}, 1.5f }, 
+        { &uniqueTitleBGs[0], {0.34f, 0.195f}, 2.6f },
+        { &uniqueTitleBGs[1], {0.35f, 0.79f}, 3.0f },
+        { &uniqueTitleBGs[2], {0.8f, 0.36f}, 2.7f },
+        { &uniqueTitleBGs[3], {0.56f, 0.17f}, 2.7f },
+        { &uniqueTitleBGs[4], {0.73f, 0.18f}, 2.5f },
+        { &uniqueTitleBGs[5], {0.39f, 0.79f}, 3.0f },
+        { &uniqueTitleBGs[6], {0.88f, 0.83f}, 2.5f },
+        { &uniqueTitleBGs[7], {0.88f, 0.26f}, 2.9f },
+        { &uniqueTitleBGs[8], {0.125f, 0.72f}, 2.7f },
+        { &uniqueTitleBGs[9], {0.16f, 0.17f}, 2.7f },
+        { &uniqueTitleBGs[10], {0.12f, 0.42f}, 2.8f },
+        { &uniqueTitleBGs[11], {0.28f, 0.77f}, 2.7f },
+        { &uniqueTitleBGs[12], {0.67f, 0.81f}, 2.8f },
+        { &uniqueTitleBGs[13], {0.895f, 0.47f}, 2.8f },
+        { &uniqueTitleBGs[14], {0.21f, 0.82f}, 2.5f },
+        { &uniqueTitleBGs[15], {0.86f, 0.47f}, 2.8f },
+        { &uniqueTitleBGs[15], {0.825f, 0.47f}, 2.8f }, 
+        { &uniqueTitleBGs[16], {0.615f, 0.82f}, 2.2f },
+        { &uniqueTitleBGs[17], {0.22f, 0.35f}, 1.6f }, 
+        { &uniqueTitleBGs[17], {0.78f, 0.72f}, 1.5f }, 
     };
 
-    Texture2D charSelectBg;
-    charSelectBg = LoadTexture("assets/css_bg.png"); 
-    SetTextureFilter(charSelectBg, TEXTURE_FILTER_POINT);
-
     static Texture2D texBackground;
 
-    Texture2D charBoxTex;
-    charBoxTex = LoadTexture("assets/character_box.png");
-    SetTextureFilter(charBoxTex, TEXTURE_FILTER_POINT);
-
-    Texture2D lockedBoxTex = LoadTexture("assets/locked_character_box.png");
-    SetTextureFilter(lockedBoxTex, TEXTURE_FILTER_POINT);
-
-    Texture2D infoBoxTex;
-    infoBoxTex = LoadTexture("assets/infobox.png");
-    SetTextureFilter(infoBoxTex, TEXTURE_FILTER_POINT);
-
-    Texture2D bactIcon = LoadTexture("assets/bacteriophage_icon.png");
-    SetTextureFilter(bactIcon, TEXTURE_FILTER_POINT);
-
-    Texture2D amoebaIcon = LoadTexture("assets/amoeba_icon.png");
-    SetTextureFilter(amoebaIcon, TEXTURE_FILTER_POINT);
-
-    Texture2D boxArtTex = LoadTexture("assets/boxart.png");
-
     // =========================================================
     // 6. CONFIGURAÇÃO DE UI, TEXTO E ESCALAS
     // =========================================================
     const char *title_text = "PRESS ENTER TO BEGIN";
     float fontSize = gameFont.baseSize * 1.5f; 
     float fontSpacing = 3.0f;
-    Vector2 textSize = MeasureTextEx(gameFont, title_text, fontSize, fontSpacing);
+    Vector2 textSize = MeasureTextCached(gameFont, title_text, fontSize, fontSpacing);
     Vector2 textPosition = {
         (1200 - textSize.x) / 2.0f,
         (720 / 1.65f) + 150
@@ -270,49 +387,9 @@ int main(void) {
     float CESARlogoscale = 2.0f;
     float MMlogoScale = 2.0f;
 
-    const char* demo_lock_pt = 
-        "Compre uma cópia oficial de Micro Mayhem para\naproveitar tudo!\n\n"
-        "+ 10 personagens únicos!\n"
-        "+ 1 modo história (arcade)!\n"
-        "+ Extras (arte conceitual e galeria!)\n"
-        "+ Configurações mais ambiciosas!\n"
-        "+ CPU melhorada!\n"
-        "+ Novos microambientes!\n"
-        "+ MUITO MAIS!\n\n"
-        "Por enquanto, esse recurso não está\ndisponível na demo!";
-
-    const char* demo_lock_en = 
-        "Buy an official copy of Micro Mayhem to\nenjoy everything!\n\n"
-        "+ 10 unique characters!\n"
-        "+ 1 Story Mode (Arcade)!\n"
-        "+ Extras (Concept Art & Gallery!)\n"
-        "+ More ambitious settings!\n"
-        "+ Improved CPU AI!\n"
-        "+ New Micro-Environments!\n"
-        "+ MUCH MORE!\n\n"
-        "For now, this feature is not available\nin the demo!";
-
     // =========================================================
-    // 7. DADOS DO MENU PRINCIPAL (TEXTOS E ÍCONES)
+    // 7. DADOS DO MENU PRINCIPAL (ÍCONES)
     // =========================================================
-    const char* text_menu_pt[] = { "Jogo Rápido", "Arcade", "Extras", "Opções", "Sair" };
-    const char* text_menu_en[] = { "Quick Play", "Arcade", "Extras", "Settings", "Quit Game" };
-    
-    const char *iconPaths[MENU_OPTIONS] = {
-        "assets/QP_icon.png",
-        "assets/Arcade_icon.png",
-        "assets/Extras_icon.png",
-        "assets/Settings_icon.png",
-        "assets/QG_icon.png"
-    };
-
-    Texture2D menuIcons[MENU_OPTIONS];
-    for (int i = 0; i < MENU_OPTIONS; i++) {
-        menuIcons[i] = LoadTexture(iconPaths[i]);
-        SetTextureFilter(menuIcons[i], TEXTURE_FILTER_POINT);
-        SetTextureWrap(menuIcons[i], TEXTURE_WRAP_CLAMP);
-    }
-
     float iconScales[MENU_OPTIONS] = { 3.0f, 3.0f, 3.0f, 3.0f, 3.0f };
     float baseScale = 3.0f;
     float selectedScale = 4.0f;
@@ -320,47 +397,10 @@ int main(void) {
     float floatAmp = 5.0f;
     int selectedOption = 0;
 
-    Texture2D qpIcons[2];
-    qpIcons[0] = LoadTexture("assets/SP_icon.png");
-    qpIcons[1] = LoadTexture("assets/MP_icon.png");
-
-    for(int i=0; i<2; i++) {
-        SetTextureFilter(qpIcons[i], TEXTURE_FILTER_POINT);
-        SetTextureWrap(qpIcons[i], TEXTURE_WRAP_CLAMP);
-    }
-
     float qpScales[3] = { 3.0f, 3.0f, 1.0f };
 
     // =========================================================
-    // 8. DADOS DE SUB-MENUS (QUICK PLAY E SETTINGS)
-    // =========================================================
-    const char* text_qp_pt[] = { "Um Jogador", "Multijogador", "Voltar" };
-    const char* text_qp_en[] = { "Singleplayer", "Multiplayer", "Return" };
-
-    const char* text_settings_pt[] = {
-        "Volume Geral",
-        "Música",
-        "Efeitos (SFX)",
-        "Resolução",
-        "Tela Cheia",
-        "Idioma: PT-BR",
-        "Créditos",
-        "Voltar"
-    };
-
-    const char* text_settings_en[] = {
-        "Master Volume",
-        "Music",
-        "SFX",
-        "Resolution",
-        "Fullscreen",
-        "Language: ENG",
-        "Credits",
-        "Return"
-    };
-
-    // =========================================================
-    // 9. ESTADO GLOBAL DO JOGO E SETTINGS
+    // 8. ESTADO GLOBAL DO JOGO E SETTINGS
     // =========================================================
     GameState currentState = STATE_SPLASH_FADE_IN;
     GameState returnState = STATE_MENU;
@@ -369,6 +409,11 @@ int main(void) {
     int frameCounter = 0;
     float fadeAlpha = 255.0f;
 
+    unsigned int lastFrameKey = 0;
+
+    bool isFirstFrameLogged = false;
+    bool isMenuReadyLogged = false;
+
     SetMasterVolume(settings.masterVolume);
 
     // =========================================================
@@ -376,384 +421,442 @@ int main(void) {
     // =========================================================
 
     while (running && !WindowShouldClose()) {
-        if (IsKeyPressed(KEY_F11)) {
-            ToggleFullscreen();
-            settings.fullscreen = !settings.fullscreen;
-        }
+        int simTicks = FramePacing_BeginFrame(&pacer);
+        double frameStartTime = GetTime();
 
-        if (isMenuMusicPlaying) {
-            SetMusicVolume(menuMusic, settings.musicVolume);
-            UpdateMusicStream(menuMusic);
-        }
-        else if (currentState == STATE_CHARACTER_SELECT) {
-            SetMusicVolume(cssMusic, settings.musicVolume);
-            UpdateMusicStream(cssMusic);
-        }
-        else if (currentState == STATE_GAMEPLAY) {
-            SetMusicVolume(fightMusic, settings.musicVolume);
-            UpdateMusicStream(fightMusic);
-        }
-
-        switch (currentState) {
-            case STATE_SPLASH_FADE_IN:
-                fadeAlpha -= 8.0f;
-                if (fadeAlpha <= 0) {
-                    fadeAlpha = 0;
-                    currentState = STATE_SPLASH_CESAR;
-                }
-                break;
-            case STATE_SPLASH_CESAR:
-                frameCounter++;
-                if (frameCounter > 120) {
-                    currentState = STATE_FADE_OUT;
-                    frameCounter = 0;
-                }
-                break;
+        MusicPlayer_SetVolume(settings.musicVolume);
+        MusicPlayer_Update();
+        SoundPool_SetVolume(settings.sfxVolume);
 
-            case STATE_FADE_OUT:
-                fadeAlpha += 8.0f;
-                if (fadeAlpha >= 255.0f) {
-                    fadeAlpha = 255.0f;
-                    currentState = STATE_REVEAL_MM;
-                    
-                    SetShaderValue(pixelShader, pixelSizeLoc, &currentPixelSize, SHADER_UNIFORM_FLOAT);
-                }
-                break;
+        for (int tick = 0; tick < simTicks; tick++) {
+            FramePacing_SampleInput(&pacer);
 
-            case STATE_REVEAL_MM:
-            {
-                bool pixelDone = false;
-                bool fadeDone = false;
+            if (IsKeyPressed(KEY_F3)) renderScale.showOverlay = !renderScale.showOverlay;
 
-                if (currentPixelSize > 1.0f) {
-                    currentPixelSize -= 0.3f;
-                    SetShaderValue(pixelShader, pixelSizeLoc, &currentPixelSize, SHADER_UNIFORM_FLOAT);
-                } else {
-                    currentPixelSize = 1.0f;
-                    pixelDone = true;
-                }
+            if (IsKeyPressed(KEY_F11)) {
+                ToggleFullscreen();
+                settings.fullscreen = !settings.fullscreen;
+            }
 
-                if (fadeAlpha > 0.0f) {
+            switch (currentState) {
+                case STATE_SPLASH_FADE_IN:
                     fadeAlpha -= 8.0f;
-                } else {
-                    fadeAlpha = 0.0f;
-                    fadeDone = true;
-                }
+                    if (fadeAlpha <= 0) {
+                        fadeAlpha = 0;
+                        currentState = STATE_SPLASH_CESAR;
+                    }
+                    break;
+                case STATE_SPLASH_CESAR:
+                    frameCounter++;
+                    if (frameCounter > 120) {
+                        currentState = STATE_FADE_OUT;
+                        frameCounter = 0;
+                    }
+                    break;
 
-                if (pixelDone && fadeDone) {
-                    currentState = STATE_TITLE_MM;
-                }
-            }
-                break;
+                case STATE_FADE_OUT:
+                    fadeAlpha += 8.0f;
+                    if (fadeAlpha >= 255.0f) {
+                        fadeAlpha = 255.0f;
+                        currentState = STATE_REVEAL_MM;
+                    
+                        SetShaderValue(pixelShader, pixelSizeLoc, &currentPixelSize, SHADER_UNIFORM_FLOAT);
+                    }
+                    break;
 
-            case STATE_TITLE_MM:
-                if (!isMenuMusicPlaying) {
-                    PlayMusicStream(menuMusic);
-                    isMenuMusicPlaying = true;
-                }
-                if (IsKeyPressed(KEY_ENTER)){
-                    currentState = STATE_MENU;
+                case STATE_REVEAL_MM:
+                {
+                    bool pixelDone = false;
+                    bool fadeDone = false;
+
+                    if (currentPixelSize > 1.0f) {
+                        currentPixelSize -= 0.3f;
+                        SetShaderValue(pixelShader, pixelSizeLoc, &currentPixelSize, SHADER_UNIFORM_FLOAT);
+                    } else {
+                        currentPixelSize = 1.0f;
+                        pixelDone = true;
+                    }
+
+                    if (fadeAlpha > 0.0f) {
+                        fadeAlpha -= 8.0f;
+                    } else {
+                        fadeAlpha = 0.0f;
+                        fadeDone = true;
+                    }
+
+                    if (pixelDone && fadeDone) {
+                        currentState = STATE_TITLE_MM;
+                    }
                 }
-                break;
+                    break;
+
+                case STATE_TITLE_MM:
+                    MusicPlayer_Play(menuMusic);
+                    if (IsKeyPressed(KEY_ENTER)){
+                        currentState = STATE_MENU;
+                    }
+                    break;
             
-            case STATE_MENU:
-                if (IsKeyPressed(KEY_RIGHT) || IsKeyPressed(KEY_D)) {
-                    selectedOption++;
-                    if (selectedOption >= MENU_OPTIONS) selectedOption = 0;
-                    PlaySound(sndSelect);
-                }
+                case STATE_MENU:
+                    if (IsKeyPressed(KEY_RIGHT) || IsKeyPressed(KEY_D)) {
+                        selectedOption++;
+                        if (selectedOption >= MENU_OPTIONS) selectedOption = 0;
+                        PlaySound(sndSelect);
+                    }
 
-                if (IsKeyPressed(KEY_LEFT) || IsKeyPressed(KEY_A)) {
-                    selectedOption--;
-                    if (selectedOption < 0) selectedOption = MENU_OPTIONS - 1;
-                    PlaySound(sndSelect);
-                }
+                    if (IsKeyPressed(KEY_LEFT) || IsKeyPressed(KEY_A)) {
+                        selectedOption--;
+                        if (selectedOption < 0) selectedOption = MENU_OPTIONS - 1;
+                        PlaySound(sndSelect);
+                    }
 
-                if (IsKeyPressed(KEY_ENTER)) {
-                    PlaySound(sndSelected);
-                    switch (selectedOption) {
-                        case 0:
-                            currentState = STATE_QUICKPLAY_MENU;
-                            selectedOption = 0;
-                            break;
-                        case 1:
-                            returnState = STATE_MENU;
-                            currentState = STATE_DEMO_LOCK;
-                            break;
-                        case 2:
-                            returnState = STATE_MENU;
-                            currentState = STATE_DEMO_LOCK;
-                            break;
-                        case 3:
-                            returnState = STATE_MENU;
-                            currentState = STATE_SETTINGS;
-                            selectedOption = 0;
-                            break;
-                        case 4:
-                            running = false;
-                            break;
+                    if (IsKeyPressed(KEY_ENTER)) {
+                        PlaySound(sndSelected);
+                        switch (selectedOption) {
+                            case 0:
+                                currentState = STATE_QUICKPLAY_MENU;
+                                selectedOption = 0;
+                                break;
+                            case 1:
+                                returnState = STATE_MENU;
+                                currentState = STATE_DEMO_LOCK;
+                                break;
+                            case 2:
+                                returnState = STATE_MENU;
+                                currentState = STATE_DEMO_LOCK;
+                                break;
+                            case 3:
+                                returnState = STATE_MENU;
+                                currentState = STATE_SETTINGS;
+                                selectedOption = 0;
+                                break;
+                            case 4:
+                                running = false;
+                                break;
+                        }
                     }
-                }
-                break;
+                    break;
 
-            case STATE_QUICKPLAY_MENU:
-                if (IsKeyPressed(KEY_RIGHT) || IsKeyPressed(KEY_D)) {
-                    selectedOption++;
-                    if (selectedOption > 2) selectedOption = 0;
-                    PlaySound(sndSelect);
-                }
+                case STATE_QUICKPLAY_MENU:
+                    if (IsKeyPressed(KEY_RIGHT) || IsKeyPressed(KEY_D)) {
+                        selectedOption++;
+                        if (selectedOption > 2) selectedOption = 0;
+                        PlaySound(sndSelect);
+                    }
 
-                if (IsKeyPressed(KEY_LEFT) || IsKeyPressed(KEY_A)) {
-                    selectedOption--;
-                    if (selectedOption < 0) selectedOption = 2;
-                    PlaySound(sndSelect);
-                }
-                if (IsKeyPressed(KEY_ENTER)) {
-                    PlaySound(sndSelected);
-                    switch (selectedOption) {
-                        case 0:
-                            StopMusicStream(menuMusic);
-                            PlayMusicStream(cssMusic);
-                            isMenuMusicPlaying = false;
-
-                            GameScene_SetMultiplayer(false);
-                            isMultiplayer = false;
+                    if (IsKeyPressed(KEY_LEFT) || IsKeyPressed(KEY_A)) {
+                        selectedOption--;
+                        if (selectedOption < 0) selectedOption = 2;
+                        PlaySound(sndSelect);
+                    }
+                    if (IsKeyPressed(KEY_ENTER)) {
+                        PlaySound(sndSelected);
+                        switch (selectedOption) {
+                            case 0:
+                                MusicPlayer_Play(cssMusic);
+
+                                GameScene_SetMultiplayer(false);
+                                isMultiplayer = false;
                             
-                            currentState = STATE_CHARACTER_SELECT;
-                            p1Selection = 0;
-                            p2Selection = 1;
-                            isSelectingP2 = false;
-                            inputDelayTimer = 30;
-                            break;
+                                currentState = STATE_CHARACTER_SELECT;
+                                p1Selection = 0;
+                                p2Selection = 1;
+                                isSelectingP2 = false;
+                                inputDelayTimer = 30;
+                                break;
                             
-                        case 1:
-                            StopMusicStream(menuMusic);
-                            PlayMusicStream(cssMusic);
-                            isMenuMusicPlaying = false;
-
-                            GameScene_SetMultiplayer(true);
-                            isMultiplayer = true;
-
-                            currentState = STATE_CHARACTER_SELECT;
-                            p1Selection = 0;
-                            p2Selection = 0;
-                            isSelectingP2 = false;
-                            inputDelayTimer = 30;
-                            break;
+                            case 1:
+                                MusicPlayer_Play(cssMusic);
+
+                                GameScene_SetMultiplayer(true);
+                                isMultiplayer = true;
+
+                                currentState = STATE_CHARACTER_SELECT;
+                                p1Selection = 0;
+                                p2Selection = 0;
+                                isSelectingP2 = false;
+                                inputDelayTimer = 30;
+                                break;
                             
-                        case 2:
-                            currentState = STATE_MENU;
-                            selectedOption = 0;
-                            break;
-                    }
-                }
-                break;
-
-                case STATE_CHARACTER_SELECT:
-                {
-                    if (inputDelayTimer > 0) {
-                        inputDelayTimer--;
+                            case 2:
+                                currentState = STATE_MENU;
+                                selectedOption = 0;
+                                break;
+                        }
                     }
+                    break;
 
-                    if (isSelectingP2) {
-                        if (inputDelayTimer <= 0) {
-                            if (IsKeyPressed(KEY_LEFT) || IsKeyPressed(KEY_A) || 
-                                IsKeyPressed(KEY_RIGHT) || IsKeyPressed(KEY_D) ||
-                                IsKeyPressed(KEY_DOWN) || IsKeyPressed(KEY_S) ||
-                                IsKeyPressed(KEY_UP) || IsKeyPressed(KEY_W)) {
-                                    PlaySound(sndSelect);
-                            }
+                    case STATE_CHARACTER_SELECT:
+                    {
+                        if (inputDelayTimer > 0) {
+                            inputDelayTimer--;
+                        }
 
-                            if (IsKeyPressed(KEY_LEFT) || IsKeyPressed(KEY_A)) p2Selection--;
-                            if (IsKeyPressed(KEY_RIGHT) || IsKeyPressed(KEY_D)) p2Selection++;
-                            if (IsKeyPressed(KEY_DOWN) || IsKeyPressed(KEY_S)) p2Selection += 4;
-                            if (IsKeyPressed(KEY_UP) || IsKeyPressed(KEY_W)) p2Selection -= 4;
-
-                            if (p2Selection < 0) p2Selection += CHAR_COUNT;
-                            if (p2Selection >= CHAR_COUNT) p2Selection -= CHAR_COUNT;
-
-                            if (IsKeyPressed(KEY_ENTER)) {
-                                if (p2Selection > 1) {
-                                    returnState = STATE_CHARACTER_SELECT; 
-                                    currentState = STATE_DEMO_LOCK;
-                                    PlaySound(sndSelected); 
-                                } else {
-                                    StopMusicStream(cssMusic);
-                                    
-                                    PlayMusicStream(fightMusic);
-                                    
-                                    GameScene_SetLanguage(settings.language);
-                                    GameScene_Init(p1Selection, p2Selection); 
-                                    currentState = STATE_GAMEPLAY;
+                        if (isSelectingP2) {
+                            if (inputDelayTimer <= 0) {
+                                if (IsKeyPressed(KEY_LEFT) || IsKeyPressed(KEY_A) || 
+                                    IsKeyPressed(KEY_RIGHT) || IsKeyPressed(KEY_D) ||
+                                    IsKeyPressed(KEY_DOWN) || IsKeyPressed(KEY_S) ||
+                                    IsKeyPressed(KEY_UP) || IsKeyPressed(KEY_W)) {
+                                        PlaySound(sndSelect);
                                 }
-                            }
 
-                            if (IsKeyPressed(KEY_BACKSPACE) || IsKeyPressed(KEY_ESCAPE)) {
-                                isSelectingP2 = false; 
-                                inputDelayTimer = 15;
-                            }
-                        }
-                    }
-                
-                    else {
-                        if (inputDelayTimer <= 0) {
-                            if (IsKeyPressed(KEY_LEFT) || IsKeyPressed(KEY_A) || 
-                                IsKeyPressed(KEY_RIGHT) || IsKeyPressed(KEY_D) ||
-                                IsKeyPressed(KEY_DOWN) || IsKeyPressed(KEY_S) ||
-                                IsKeyPressed(KEY_UP) || IsKeyPressed(KEY_W)) {
-                                    PlaySound(sndSelect);
-                            }
+                                if (IsKeyPressed(KEY_LEFT) || IsKeyPressed(KEY_A)) p2Selection--;
+                                if (IsKeyPressed(KEY_RIGHT) || IsKeyPressed(KEY_D)) p2Selection++;
+                                if (IsKeyPressed(KEY_DOWN) || IsKeyPressed(KEY_S)) p2Selection += 4;
+                                if (IsKeyPressed(KEY_UP) || IsKeyPressed(KEY_W)) p2Selection -= 4;
 
-                            if (IsKeyPressed(KEY_LEFT) || IsKeyPressed(KEY_A)) p1Selection--;
-                            if (IsKeyPressed(KEY_RIGHT) || IsKeyPressed(KEY_D)) p1Selection++;
-                            if (IsKeyPressed(KEY_DOWN) || IsKeyPressed(KEY_S)) p1Selection += 4;
-                            if (IsKeyPressed(KEY_UP) || IsKeyPressed(KEY_W)) p1Selection -= 4;
-
-                            if (p1Selection < 0) p1Selection += CHAR_COUNT;
-                            if (p1Selection >= CHAR_COUNT) p1Selection -= CHAR_COUNT;
-
-                            if (IsKeyPressed(KEY_ENTER)) {
-                                if (p1Selection > 1) {
-                                    returnState = STATE_CHARACTER_SELECT;
-                                    currentState = STATE_DEMO_LOCK;
-                                    PlaySound(sndSelected);
-                                } 
-                                else {
-                                    if (isMultiplayer) {
-                                        isSelectingP2 = true;
-                                        inputDelayTimer = 20;
-                                    } else {
-                                        StopMusicStream(cssMusic);
-                                        
-                                        PlayMusicStream(fightMusic);
-                                        
-                                        GameScene_SetLanguage(settings.language);
+                                if (p2Selection < 0) p2Selection += CHAR_COUNT;
+                                if (p2Selection >= CHAR_COUNT) p2Selection -= CHAR_COUNT;
 
-                                        int cpuID = GetRandomValue(0, 1);
+                                if (IsKeyPressed(KEY_ENTER)) {
+                                    if (p2Selection > 1) {
+                                        returnState = STATE_CHARACTER_SELECT; 
+                                        currentState = STATE_DEMO_LOCK;
+                                        PlaySound(sndSelected); 
+                                    } else {
+                                        MusicPlayer_Play(fightMusic);
 
-                                        GameScene_Init(p1Selection, cpuID); 
+                                        GameScene_Init(p1Selection, p2Selection); 
                                         currentState = STATE_GAMEPLAY;
                                     }
                                 }
+
+                                if (IsKeyPressed(KEY_BACKSPACE) || IsKeyPressed(KEY_ESCAPE)) {
+                                    isSelectingP2 = false; 
+                                    inputDelayTimer = 15;
+                                }
                             }
+                        }
+                
+                        else {
+                            if (inputDelayTimer <= 0) {
+                                if (IsKeyPressed(KEY_LEFT) || IsKeyPressed(KEY_A) || 
+                                    IsKeyPressed(KEY_RIGHT) || IsKeyPressed(KEY_D) ||
+                                    IsKeyPressed(KEY_DOWN) || IsKeyPressed(KEY_S) ||
+                                    IsKeyPressed(KEY_UP) || IsKeyPressed(KEY_W)) {
+                                        PlaySound(sndSelect);
+                                }
 
-                            if (IsKeyPressed(KEY_BACKSPACE) || IsKeyPressed(KEY_ESCAPE)) {
-                                StopMusicStream(cssMusic);
-                                PlayMusicStream(menuMusic);
-                                isMenuMusicPlaying = true;
-                                currentState = STATE_QUICKPLAY_MENU;
+                                if (IsKeyPressed(KEY_LEFT) || IsKeyPressed(KEY_A)) p1Selection--;
+                                if (IsKeyPressed(KEY_RIGHT) || IsKeyPressed(KEY_D)) p1Selection++;
+                                if (IsKeyPressed(KEY_DOWN) || IsKeyPressed(KEY_S)) p1Selection += 4;
+                                if (IsKeyPressed(KEY_UP) || IsKeyPressed(KEY_W)) p1Selection -= 4;
+
+                                if (p1Selection < 0) p1Selection += CHAR_COUNT;
+                                if (p1Selection >= CHAR_COUNT) p1Selection -= CHAR_COUNT;
+
+                                if (IsKeyPressed(KEY_ENTER)) {
+                                    if (p1Selection > 1) {
+                                        returnState = STATE_CHARACTER_SELECT;
+                                        currentState = STATE_DEMO_LOCK;
+                                        PlaySound(sndSelected);
+                                    } 
+                                    else {
+                                        if (isMultiplayer) {
+                                            isSelectingP2 = true;
+                                            inputDelayTimer = 20;
+                                        } else {
+                                            MusicPlayer_Play(fightMusic);
+
+                                            int cpuID = GetRandomValue(0, 1);
+
+                                            GameScene_Init(p1Selection, cpuID); 
+                                            currentState = STATE_GAMEPLAY;
+                                        }
+                                    }
+                                }
+
+                                if (IsKeyPressed(KEY_BACKSPACE) || IsKeyPressed(KEY_ESCAPE)) {
+                                    MusicPlayer_Play(menuMusic);
+                                    currentState = STATE_QUICKPLAY_MENU;
+                                }
                             }
                         }
-                    }
 
-                }
-                break;
+                    }
+                    break;
             
-            case STATE_SETTINGS:
-                if (IsKeyPressed(KEY_DOWN)) {
-                    selectedOption++;
-                    if (selectedOption >= SETTINGS_OPTIONS) selectedOption = 0;
-                    PlaySound(sndSelect);
-                }
-                if (IsKeyPressed(KEY_UP)) {
-                    selectedOption--;
-                    if (selectedOption < 0) selectedOption = SETTINGS_OPTIONS - 1;
-                    PlaySound(sndSelect);
-                }
+                case STATE_SETTINGS:
+                    if (IsKeyPressed(KEY_DOWN)) {
+                        selectedOption++;
+                        if (selectedOption >= SETTINGS_OPTIONS) selectedOption = 0;
+                        PlaySound(sndSelect);
+                    }
+                    if (IsKeyPressed(KEY_UP)) {
+                        selectedOption--;
+                        if (selectedOption < 0) selectedOption = SETTINGS_OPTIONS - 1;
+                        PlaySound(sndSelect);
+                    }
 
-                if (IsKeyPressed(KEY_LEFT) || IsKeyPressed(KEY_RIGHT)) {
+                    if (IsKeyPressed(KEY_LEFT) || IsKeyPressed(KEY_RIGHT)) {
 
-                    int dir = IsKeyPressed(KEY_RIGHT) ? 1 : -1;
+                        int dir = IsKeyPressed(KEY_RIGHT) ? 1 : -1;
 
-                    PlaySound(sndSelect);
+                        PlaySound(sndSelect);
 
-                    switch(selectedOption) {
-                        case 0: settings.masterVolume += 0.1f * dir; break;
-                        case 1: settings.musicVolume += 0.1f * dir; break;
-                        case 2: settings.sfxVolume += 0.1f * dir; break;
-                        case 3:
-                            settings.resolutionIndex += dir;
-                            if (settings.resolutionIndex >= maxResolutions) settings.resolutionIndex = 0;
-                            if (settings.resolutionIndex < 0) settings.resolutionIndex = maxResolutions - 1;
+                        switch(selectedOption) {
+                            case 0: settings.masterVolume += 0.1f * dir; break;
+                            case 1: settings.musicVolume += 0.1f * dir; break;
+                            case 2: settings.sfxVolume += 0.1f * dir; break;
+                            case 3:
+                                settings.resolutionIndex += dir;
+                                if (settings.resolutionIndex >= maxResolutions) settings.resolutionIndex = 0;
+                                if (settings.resolutionIndex < 0) settings.resolutionIndex = maxResolutions - 1;
                             
-                            SetWindowSize(resWidths[settings.resolutionIndex], resHeights[settings.resolutionIndex]);
-                            SetWindowPosition((GetMonitorWidth(0) - resWidths[settings.resolutionIndex])/2, (GetMonitorHeight(0) - resHeights[settings.resolutionIndex])/2);
-                            break;
-                        case 4:
+                                SetWindowSize(resWidths[settings.resolutionIndex], resHeights[settings.resolutionIndex]);
+                                SetWindowPosition((GetMonitorWidth(0) - resWidths[settings.resolutionIndex])/2, (GetMonitorHeight(0) - resHeights[settings.resolutionIndex])/2);
+                                break;
+                            case 4:
+                                ToggleFullscreen();
+                                settings.fullscreen = IsWindowFullscreen(); 
+                                break;
+                            case 5:
+                                settings.language = (settings.language + LANG_COUNT + dir) % LANG_COUNT; 
+                                Loc_SetLanguage(settings.language);
+                                break;
+                            case 6:
+                                settings.presentMode = (settings.presentMode + PRESENT_MODE_COUNT + dir) % PRESENT_MODE_COUNT;
+                                FramePacing_SetMode(&pacer, settings.presentMode);
+                                break;
+                            case 7:
+                                settings.inputBufferFrames += dir;
+                                if (settings.inputBufferFrames > INPUT_BUFFER_MAX) settings.inputBufferFrames = INPUT_BUFFER_MAX;
+                                if (settings.inputBufferFrames < 0) settings.inputBufferFrames = 0;
+                                GameScene_SetInputBuffer(settings.inputBufferFrames);
+                                break;
+                            case 8:
+                                settings.cpuDifficulty = (settings.cpuDifficulty + CPU_DIFFICULTY_COUNT + dir) % CPU_DIFFICULTY_COUNT;
+                                GameScene_SetCPUDifficulty(settings.cpuDifficulty);
+                                break;
+                        }
+                    }
+
+                    if (settings.masterVolume > 1.0f) settings.masterVolume = 1.0f;
+                    if (settings.masterVolume < 0.0f) settings.masterVolume = 0.0f;
+                    if (settings.musicVolume > 1.0f) settings.musicVolume = 1.0f;
+                    if (settings.musicVolume < 0.0f) settings.musicVolume = 0.0f;
+                    if (settings.sfxVolume > 1.0f) settings.sfxVolume = 1.0f;
+                    if (settings.sfxVolume < 0.0f) settings.sfxVolume = 0.0f;
+                
+                    SetMasterVolume(settings.masterVolume);
+                    MusicPlayer_SetVolume(settings.musicVolume);
+
+                    if (IsKeyPressed(KEY_ENTER)) {
+                        PlaySound(sndSelected);
+                        if (selectedOption == 4) {
                             ToggleFullscreen();
-                            settings.fullscreen = IsWindowFullscreen(); 
-                            break;
-                        case 5:
-                            settings.language = (settings.language == LANG_EN) ? LANG_PT : LANG_EN; 
-                            break;
+                            settings.fullscreen = IsWindowFullscreen();
+                            SaveGameSettings(&settings);
+                        }
+                        else if (selectedOption == 9) {
+                            currentState = STATE_CREDITS;
+                        }
+                        else if (selectedOption == 10) {
+                            SaveGameSettings(&settings);
+                        
+                            currentState = returnState;
+                        
+                            if (returnState == STATE_MENU) selectedOption = 3;
+                        }
                     }
-                }
+                    break;
 
-                if (settings.masterVolume > 1.0f) settings.masterVolume = 1.0f;
-                if (settings.masterVolume < 0.0f) settings.masterVolume = 0.0f;
-                if (settings.musicVolume > 1.0f) settings.musicVolume = 1.0f;
-                if (settings.musicVolume < 0.0f) settings.musicVolume = 0.0f;
-                if (settings.sfxVolume > 1.0f) settings.sfxVolume = 1.0f;
-                if (settings.sfxVolume < 0.0f) settings.sfxVolume = 0.0f;
+                case STATE_CREDITS:
+                    if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_ESCAPE)) {
+                        currentState = STATE_MENU;
+                        selectedOption = 0;
+                    }
+                    break;
+
+                case STATE_GAMEPLAY:
+                    int gameResult = GameScene_Update();
                 
-                SetMasterVolume(settings.masterVolume);
-                if (isMenuMusicPlaying) SetMusicVolume(menuMusic, settings.musicVolume);
-
-                if (IsKeyPressed(KEY_ENTER)) {
-                    PlaySound(sndSelected);
-                    if (selectedOption == 4) {
-                        ToggleFullscreen();
-                        settings.fullscreen = IsWindowFullscreen();
-                        SaveGameSettings(&settings);
+                    if (gameResult == 1) {
+                        currentState = STATE_QUICKPLAY_MENU;
+                        selectedOption = 0;
+                        MusicPlayer_Play(menuMusic);
                     }
-                    else if (selectedOption == 6) {
-                        currentState = STATE_CREDITS;
+                    else if (gameResult == 2) {
+                        returnState = STATE_GAMEPLAY;
+                        currentState = STATE_SETTINGS;
+                        selectedOption = 0; 
                     }
-                    else if (selectedOption == 7) {
-                        SaveGameSettings(&settings);
-                        
+                    break;
+
+                case STATE_DEMO_LOCK:
+                    if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_BACKSPACE)) {
                         currentState = returnState;
-                        
-                        if (returnState == STATE_MENU) selectedOption = 3;
                     }
-                }
-                break;
+                    break;
+            }
+        }
 
-            case STATE_CREDITS:
-                if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_ESCAPE)) {
-                    currentState = STATE_MENU;
-                    selectedOption = 0;
-                }
-                break;
+        // Mudou de tela: troca de cena (bloqueia só se as texturas dela não
+        // chegaram); a provável próxima cena sobe aos poucos
+        SceneStack_Goto(GetSceneForState(currentState));
+        SceneStack_Prefetch(GetNextSceneForState(currentState));
+        TextureStream_Update(TEXTURE_UPLOAD_BUDGET);
 
-            case STATE_GAMEPLAY:
-                int gameResult = GameScene_Update();
-                
-                if (gameResult == 1) {
-                    StopMusicStream(fightMusic);
-                    
-                    currentState = STATE_QUICKPLAY_MENU;
-                    selectedOption = 0;
-                    if (!isMenuMusicPlaying) {
-                        PlayMusicStream(menuMusic);
-                        isMenuMusicPlaying = true;
+        if (!isMenuReadyLogged && ResourceSet_IsResident(&frontendResources)) {
+            printf("STARTUP: Texturas ate o menu prontas em %.1f ms\n", GetTime() * 1000.0);
+            isMenuReadyLogged = true;
+        }
+
+        // =========================================================
+        // TELAS ESTÁTICAS: SÓ REDESENHA QUANDO ALGO VISÍVEL MUDOU
+        // =========================================================
+        bool isIdleScreen = (currentState == STATE_TITLE_MM || currentState == STATE_MENU || currentState == STATE_QUICKPLAY_MENU ||
+                             currentState == STATE_SETTINGS || currentState == STATE_CREDITS || currentState == STATE_DEMO_LOCK);
+
+        if (isIdleScreen && !renderScale.showOverlay) {
+            unsigned int frameKey = 2166136261u;
+            frameKey = HashFrameValue(frameKey, currentState);
+            frameKey = HashFrameValue(frameKey, selectedOption);
+            frameKey = HashFrameValue(frameKey, renderScale.step);
+            frameKey = HashFrameValue(frameKey, GetScreenWidth());
+            frameKey = HashFrameValue(frameKey, GetScreenHeight());
+            frameKey = HashFrameValue(frameKey, IsWindowFocused());
+            frameKey = HashFrameBytes(frameKey, &settings, sizeof(GameSettings));
+
+            bool isAnimating = false;
+
+            if (currentState == STATE_TITLE_MM) {
+                frameKey = HashFrameValue(frameKey, fmod(GetTime(), 1.0) < 0.5);
+            }
+            else if (currentState == STATE_MENU || currentState == STATE_QUICKPLAY_MENU) {
+                // O ícone selecionado flutua: só conta quando muda de pixel
+                frameKey = HashFrameValue(frameKey, (int)roundf(sinf(GetTime() * floatSpeed) * floatAmp));
+
+                if (currentState == STATE_MENU) {
+                    for (int i = 0; i < MENU_OPTIONS; i++) {
+                        float targetScale = (i == selectedOption) ? selectedScale : baseScale;
+                        if (fabsf(iconScales[i] - targetScale) > 0.01f) isAnimating = true;
+                    }
+                } else {
+                    for (int i = 0; i < 3; i++) {
+                        float targetScale = (i == selectedOption) ? ((i == 2) ? 1.2f : 4.0f) : ((i == 2) ? 1.0f : 3.0f);
+                        if (fabsf(qpScales[i] - targetScale) > 0.01f) isAnimating = true;
                     }
                 }
-                else if (gameResult == 2) {
-                    returnState = STATE_GAMEPLAY;
-                    currentState = STATE_SETTINGS;
-                    selectedOption = 0; 
-                }
-                break;
+            }
 
-            case STATE_DEMO_LOCK:
-                if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_BACKSPACE)) {
-                    currentState = returnState;
-                }
-                break;
+            bool frameUnchanged = (frameKey == lastFrameKey) && !isAnimating && !IsWindowResized();
+            lastFrameKey = frameKey;
+
+            // Nada mudou: a janela continua mostrando o último frame apresentado
+            if (frameUnchanged) {
+                FramePacing_Idle(&pacer);
+                continue;
+            }
+        } else {
+            lastFrameKey = 0;
         }
 
+        renderResolution = RenderScale_GetRenderSize(&renderScale);
+
         BeginTextureMode(target);
+        BeginMode2D(RenderScale_GetCamera(&renderScale));
             if (currentState == STATE_REVEAL_MM || currentState == STATE_TITLE_MM || currentState == STATE_MENU || currentState == STATE_QUICKPLAY_MENU) {
                 BeginShaderMode(gradientShader);
                 SetShaderValue(gradientShader, resLoc, &renderResolution, SHADER_UNIFORM_VEC2);
@@ -803,7 +906,7 @@ int main(void) {
                     if (currentState == STATE_TITLE_MM) {
                         bool showText = fmod(GetTime(), 1.0) < 0.5;
                         if (showText) {
-                            DrawTextEx(gameFont, title_text, textPosition, fontSize, fontSpacing, RAYWHITE);
+                            DrawTextCached(gameFont, title_text, textPosition, fontSize, fontSpacing, RAYWHITE);
                         }
                     }
                     break;
@@ -812,8 +915,6 @@ int main(void) {
                 {
                     DrawInitialBackground(1200, 720, titleBGs, mmLogo, MMlogoScale);
 
-                    const char **currentText = (settings.language == LANG_EN) ? text_menu_en : text_menu_pt;
-
                     Vector2 menuPositions[MENU_OPTIONS] = {
                         { 300, 320 },
                         { 600, 280 },
@@ -849,15 +950,15 @@ int main(void) {
 
                         DrawTextureEx(icon, (Vector2){drawX, drawY}, 0.0f, scale, tint);
                     
-                        const char* labelText = currentText[i];
-                        Vector2 labelSize = MeasureTextEx(mainFont, labelText, mainFont.baseSize * labelScale, labelSpacing);
+                        const char* labelText = Loc_Get(STR_MENU_QUICKPLAY + i);
+                        Vector2 labelSize = Loc_Measure(STR_MENU_QUICKPLAY + i, mainFont, mainFont.baseSize * labelScale, labelSpacing);
 
                         float textX = drawX + (scaledW / 2.0f) - (labelSize.x / 2.0f);
                         float textY = drawY + scaledH + 10.0f;
 
                         Color textColor = (i == selectedOption) ? (Color){255, 255, 150, 255} : GRAY;
 
-                        DrawTextEx(mainFont, labelText, (Vector2){textX, textY}, mainFont.baseSize * labelScale, labelSpacing, textColor);
+                        DrawTextCached(mainFont, labelText, (Vector2){textX, textY}, mainFont.baseSize * labelScale, labelSpacing, textColor);
                     }
                 }
                 break;
@@ -865,14 +966,11 @@ int main(void) {
                 case STATE_SETTINGS:
                 {
                     ClearBackground((Color){10, 12, 30, 255});
-                    const char **currentSetText = (settings.language == LANG_EN) ? text_settings_en : text_settings_pt;
-                    
-                    const char* settTitle = (settings.language == LANG_EN) ? "Settings" : "Configurações";
-                    DrawTextEx(mainFont, settTitle, (Vector2){100, 60}, fontSizeTitle, mainFontSpacing, WHITE);
+                    DrawTextCached(mainFont, Loc_Get(STR_SETTINGS_TITLE), (Vector2){100, 60}, fontSizeTitle, mainFontSpacing, WHITE);
 
                     for (int i = 0; i < SETTINGS_OPTIONS; i++) {
                         Color color = (i == selectedOption) ? YELLOW : GRAY;
-                        DrawTextEx(mainFont, currentSetText[i], (Vector2){100, 180 + (i * 70)}, fontSizeOption, mainFontSpacing, color);
+                        DrawTextCached(mainFont, Loc_Get(STR_SETTINGS_MASTER_VOLUME + i), (Vector2){100, 160 + (i * 50)}, fontSizeOption, mainFontSpacing, color);
 
                         char valText[40];
                         sprintf(valText, ""); 
@@ -881,9 +979,12 @@ int main(void) {
                         else if (i == 1) sprintf(valText, "< %.0f%% >", settings.musicVolume * 100);
                         else if (i == 2) sprintf(valText, "< %.0f%% >", settings.sfxVolume * 100);
                         else if (i == 3) sprintf(valText, "< %dx%d >", resWidths[settings.resolutionIndex], resHeights[settings.resolutionIndex]);
+                        else if (i == 6) sprintf(valText, "< %s >", Loc_Get(STR_PRESENT_VSYNC + settings.presentMode));
+                        else if (i == 7) sprintf(valText, Loc_Get(STR_SETTINGS_BUFFER_VALUE), settings.inputBufferFrames);
+                        else if (i == 8) sprintf(valText, "< %s >", Loc_Get(STR_CPU_EASY + settings.cpuDifficulty));
                         
-                        if (i < 5) {
-                             DrawTextEx(mainFont, valText, (Vector2){500, 180 + (i * 70)}, fontSizeOption, mainFontSpacing, WHITE);
+                        if (i < 5 || (i >= 6 && i <= 8)) {
+                             DrawTextCached(mainFont, valText, (Vector2){500, 160 + (i * 50)}, fontSizeOption, mainFontSpacing, WHITE);
                         }
                     }
                 }
@@ -901,38 +1002,38 @@ int main(void) {
                     float sizeHeader = mainFont.baseSize * scaleCredHeader;
                     float sizeText = mainFont.baseSize * scaleCredText;
 
-                    const char* txtTitle = (settings.language == LANG_EN) ? "CREDITS" : "CREDITOS";
-                    Vector2 mTitle = MeasureTextEx(mainFont, txtTitle, sizeTitle, mainFontSpacing);
-                    DrawTextEx(mainFont, txtTitle, (Vector2){(1200 - mTitle.x)/2, 60}, sizeTitle, mainFontSpacing, WHITE);
+                    const char* txtTitle = Loc_Get(STR_CREDITS_TITLE);
+                    Vector2 mTitle = Loc_Measure(STR_CREDITS_TITLE, mainFont, sizeTitle, mainFontSpacing);
+                    DrawTextCached(mainFont, txtTitle, (Vector2){(1200 - mTitle.x)/2, 60}, sizeTitle, mainFontSpacing, WHITE);
 
                     const char* line1 = "João Pedro Pessôa - Lead Developer & Producer";
                     const char* line2 = "Davi de Lucena - Art Director";
                     const char* line3 = "Filipe Correia - QA Specialist";
 
-                    Vector2 m1 = MeasureTextEx(mainFont, line1, sizeText, mainFontSpacing);
-                    DrawTextEx(mainFont, line1, (Vector2){(1200 - m1.x)/2, 200}, sizeText, mainFontSpacing, WHITE);
+                    Vector2 m1 = MeasureTextCached(mainFont, line1, sizeText, mainFontSpacing);
+                    DrawTextCached(mainFont, line1, (Vector2){(1200 - m1.x)/2, 200}, sizeText, mainFontSpacing, WHITE);
 
-                    Vector2 m2 = MeasureTextEx(mainFont, line2, sizeText, mainFontSpacing);
-                    DrawTextEx(mainFont, line2, (Vector2){(1200 - m2.x)/2, 250}, sizeText, mainFontSpacing, WHITE);
+                    Vector2 m2 = MeasureTextCached(mainFont, line2, sizeText, mainFontSpacing);
+                    DrawTextCached(mainFont, line2, (Vector2){(1200 - m2.x)/2, 250}, sizeText, mainFontSpacing, WHITE);
 
-                    Vector2 m3 = MeasureTextEx(mainFont, line3, sizeText, mainFontSpacing);
-                    DrawTextEx(mainFont, line3, (Vector2){(1200 - m3.x)/2, 300}, sizeText, mainFontSpacing, WHITE);
+                    Vector2 m3 = MeasureTextCached(mainFont, line3, sizeText, mainFontSpacing);
+                    DrawTextCached(mainFont, line3, (Vector2){(1200 - m3.x)/2, 300}, sizeText, mainFontSpacing, WHITE);
 
-                    const char* txtSpecial = (settings.language == LANG_EN) ? "Special Thanks" : "Agradecimentos Especiais";
-                    Vector2 mSpecial = MeasureTextEx(mainFont, txtSpecial, sizeHeader, mainFontSpacing);
-                    DrawTextEx(mainFont, txtSpecial, (Vector2){(1200 - mSpecial.x)/2, 420}, sizeHeader, mainFontSpacing, YELLOW);
+                    const char* txtSpecial = Loc_Get(STR_CREDITS_SPECIAL_THANKS);
+                    Vector2 mSpecial = Loc_Measure(STR_CREDITS_SPECIAL_THANKS, mainFont, sizeHeader, mainFontSpacing);
+                    DrawTextCached(mainFont, txtSpecial, (Vector2){(1200 - mSpecial.x)/2, 420}, sizeHeader, mainFontSpacing, YELLOW);
 
                     const char* lineTiago = "Tiago Barros";
-                    Vector2 mTiago = MeasureTextEx(mainFont, lineTiago, sizeText, mainFontSpacing);
-                    DrawTextEx(mainFont, lineTiago, (Vector2){(1200 - mTiago.x)/2, 470}, sizeText, mainFontSpacing, WHITE);
+                    Vector2 mTiago = MeasureTextCached(mainFont, lineTiago, sizeText, mainFontSpacing);
+                    DrawTextCached(mainFont, lineTiago, (Vector2){(1200 - mTiago.x)/2, 470}, sizeText, mainFontSpacing, WHITE);
                     
                     const char* lineDaniel = "Daniel Bezerra";
-                    Vector2 mDaniel = MeasureTextEx(mainFont, lineDaniel, sizeText, mainFontSpacing);
-                    DrawTextEx(mainFont, lineDaniel, (Vector2){(1200 - mDaniel.x)/2, 510}, sizeText, mainFontSpacing, WHITE);
+                    Vector2 mDaniel = MeasureTextCached(mainFont, lineDaniel, sizeText, mainFontSpacing);
+                    DrawTextCached(mainFont, lineDaniel, (Vector2){(1200 - mDaniel.x)/2, 510}, sizeText, mainFontSpacing, WHITE);
 
-                    const char* returnText = (settings.language == LANG_EN) ? "Press ENTER to Return" : "Pressione ENTER para Voltar";
-                    Vector2 mRet = MeasureTextEx(mainFont, returnText, sizeText, mainFontSpacing);
-                    DrawTextEx(mainFont, returnText, (Vector2){(1200 - mRet.x)/2, 620}, sizeText, mainFontSpacing, DARKGRAY);
+                    const char* returnText = Loc_Get(STR_PRESS_ENTER_RETURN);
+                    Vector2 mRet = Loc_Measure(STR_PRESS_ENTER_RETURN, mainFont, sizeText, mainFontSpacing);
+                    DrawTextCached(mainFont, returnText, (Vector2){(1200 - mRet.x)/2, 620}, sizeText, mainFontSpacing, DARKGRAY);
                 }
                 break;
 
@@ -940,10 +1041,7 @@ int main(void) {
                 {
                     DrawInitialBackground(1200, 720, titleBGs, mmLogo, MMlogoScale);
                     
-                    const char **qpText = (settings.language == LANG_EN) ? text_qp_en : text_qp_pt;
-                    const char *qpTitle = (settings.language == LANG_EN) ? "GAME MODE" : "MODO DE JOGO";
-
-                    DrawTextEx(mainFont, qpTitle, (Vector2){(1200 - MeasureTextEx(mainFont, qpTitle, fontSizeTitle, mainFontSpacing).x) / 2, 50}, fontSizeTitle, mainFontSpacing, WHITE);
+                    DrawTextCached(mainFont, Loc_Get(STR_QP_TITLE), (Vector2){(1200 - Loc_Measure(STR_QP_TITLE, mainFont, fontSizeTitle, mainFontSpacing).x) / 2, 50}, fontSizeTitle, mainFontSpacing, WHITE);
 
                     Vector2 qpPositions[3] = {
                         { 400, 360 },
@@ -980,27 +1078,27 @@ int main(void) {
 
                             DrawTextureEx(icon, drawPos, 0.0f, scale, tint);
 
-                            const char* label = qpText[i];
+                            const char* label = Loc_Get(STR_QP_SINGLEPLAYER + i);
                             float lblScale = 1.2f;
-                            Vector2 lblSize = MeasureTextEx(mainFont, label, mainFont.baseSize * lblScale, 1.5f);
+                            Vector2 lblSize = Loc_Measure(STR_QP_SINGLEPLAYER + i, mainFont, mainFont.baseSize * lblScale, 1.5f);
                             
                             float textX = drawX + (scaledW / 2.0f) - (lblSize.x / 2.0f);
                             float textY = drawY + scaledH + 15.0f;
 
-                            DrawTextEx(mainFont, label, (Vector2){textX, textY}, mainFont.baseSize * lblScale, 1.5f, textColor);
+                            DrawTextCached(mainFont, label, (Vector2){textX, textY}, mainFont.baseSize * lblScale, 1.5f, textColor);
                         }
 
                         else {
-                            const char* label = qpText[i];
+                            const char* label = Loc_Get(STR_QP_SINGLEPLAYER + i);
                             float scale = qpScales[i];
                             float fontSize = mainFont.baseSize * scale;
 
-                            Vector2 lblSize = MeasureTextEx(mainFont, label, fontSize, 1.5f);
+                            Vector2 lblSize = Loc_Measure(STR_QP_SINGLEPLAYER + i, mainFont, fontSize, 1.5f);
                             
                             float textX = qpPositions[i].x - (lblSize.x / 2.0f);
                             float textY = qpPositions[i].y - (lblSize.y / 2.0f) + yOffset;
 
-                            DrawTextEx(mainFont, label, (Vector2){textX, textY}, fontSize, 1.5f, textColor);
+                            DrawTextCached(mainFont, label, (Vector2){textX, textY}, fontSize, 1.5f, textColor);
                             
                             if (i == selectedOption) {
                                 DrawTriangle(
@@ -1020,8 +1118,7 @@ int main(void) {
                     Color bgTint = (Color){ 200, 200, 200, 255 }; 
                     DrawTexturePro(charSelectBg, (Rectangle){0, 0, charSelectBg.width, charSelectBg.height}, (Rectangle){0, 0, 1200, 720}, (Vector2){0, 0}, 0.0f, bgTint);
 
-                    const char* title = (settings.language == LANG_EN) ? "SELECT YOUR MICROBE" : "SELECIONE SEU MICROBIO";
-                    DrawTextEx(gameFont, title, (Vector2){(1200 - MeasureTextEx(gameFont, title, fontSizeTitle, fontSpacing).x)/2, 30}, fontSizeTitle, fontSpacing, WHITE);
+                    DrawTextCached(gameFont, Loc_Get(STR_CSS_TITLE), (Vector2){(1200 - Loc_Measure(STR_CSS_TITLE, gameFont, fontSizeTitle, fontSpacing).x)/2, 30}, fontSizeTitle, fontSpacing, WHITE);
 
                     int columns = 4;
                     int rows = 3;
@@ -1053,7 +1150,7 @@ int main(void) {
                             (Rectangle){0, 0, texToDraw.width, texToDraw.height}, 
                             boxRect, (Vector2){0,0}, 0.0f, WHITE);
 
-                        BeginScissorMode((int)drawX + 13, (int)drawY + 13, (int)boxSize - 4, (int)boxSize - 22);
+                        RenderScale_BeginScissor(&renderScale, (int)drawX + 13, (int)drawY + 13, (int)boxSize - 4, (int)boxSize - 22);
 
                         if (i == 0) {
                             float iconScale = 3.5f;
@@ -1103,43 +1200,40 @@ int main(void) {
                     float valueOffsetX = 160.0f; 
                     float nameFontSize = gameFont.baseSize;
                     
-                    const char* lblSTR = (settings.language == LANG_EN) ? "STR:" : "FOR:";
-                    const char* lblSPD = (settings.language == LANG_EN) ? "SPD:" : "VEL:";
-                    const char* statLow = (settings.language == LANG_EN) ? "LOW" : "BAIXO";
-                    const char* statMed = (settings.language == LANG_EN) ? "MED" : "MEDIO";
-                    const char* statHigh = (settings.language == LANG_EN) ? "HIGH" : "ALTO";
-                    const char* localizedLabels[] = { statLow, statMed, statHigh };
-                    const char** namesToUse = (settings.language == LANG_EN) ? charNamesEN : charNamesPT;
+                    const char* lblHP = Loc_Get(STR_STAT_HP);
+                    const char* lblSTR = Loc_Get(STR_STAT_STR);
+                    const char* lblSPD = Loc_Get(STR_STAT_SPD);
+                    const char* localizedLabels[] = { Loc_Get(STR_STAT_LOW), Loc_Get(STR_STAT_MED), Loc_Get(STR_STAT_HIGH) };
 
                     if (p1Selection > 1) {
-                         DrawTextEx(gameFont, "???", (Vector2){textLeftMargin, textTopMargin}, nameFontSize, fontSpacing, GRAY);
-                         DrawTextEx(gameFont, "HP:", (Vector2){textLeftMargin, statsStartY}, nameFontSize, fontSpacing, WHITE);
-                         DrawTextEx(gameFont, "???", (Vector2){textLeftMargin + valueOffsetX, statsStartY}, nameFontSize, fontSpacing, GRAY);
+                         DrawTextCached(gameFont, "???", (Vector2){textLeftMargin, textTopMargin}, nameFontSize, fontSpacing, GRAY);
+                         DrawTextCached(gameFont, lblHP, (Vector2){textLeftMargin, statsStartY}, nameFontSize, fontSpacing, WHITE);
+                         DrawTextCached(gameFont, "???", (Vector2){textLeftMargin + valueOffsetX, statsStartY}, nameFontSize, fontSpacing, GRAY);
                          
-                         DrawTextEx(gameFont, lblSTR, (Vector2){textLeftMargin, statsStartY + lineHeight}, nameFontSize, fontSpacing, WHITE);
-                         DrawTextEx(gameFont, "???", (Vector2){textLeftMargin + valueOffsetX, statsStartY + lineHeight}, nameFontSize, fontSpacing, GRAY);
+                         DrawTextCached(gameFont, lblSTR, (Vector2){textLeftMargin, statsStartY + lineHeight}, nameFontSize, fontSpacing, WHITE);
+                         DrawTextCached(gameFont, "???", (Vector2){textLeftMargin + valueOffsetX, statsStartY + lineHeight}, nameFontSize, fontSpacing, GRAY);
 
-                         DrawTextEx(gameFont, lblSPD, (Vector2){textLeftMargin, statsStartY + (lineHeight * 2)}, nameFontSize, fontSpacing, WHITE);
-                         DrawTextEx(gameFont, "???", (Vector2){textLeftMargin + valueOffsetX, statsStartY + (lineHeight * 2)}, nameFontSize, fontSpacing, GRAY);
+                         DrawTextCached(gameFont, lblSPD, (Vector2){textLeftMargin, statsStartY + (lineHeight * 2)}, nameFontSize, fontSpacing, WHITE);
+                         DrawTextCached(gameFont, "???", (Vector2){textLeftMargin + valueOffsetX, statsStartY + (lineHeight * 2)}, nameFontSize, fontSpacing, GRAY);
                     } 
                     else {
-                        const char* p1Txt = namesToUse[p1Selection];
-                        DrawTextEx(gameFont, p1Txt, (Vector2){textLeftMargin, textTopMargin}, nameFontSize, fontSpacing, WHITE);
+                        const char* p1Txt = Loc_GetCharacterName(p1Selection);
+                        DrawTextCached(gameFont, p1Txt, (Vector2){textLeftMargin, textTopMargin}, nameFontSize, fontSpacing, WHITE);
 
                         int hpVal = statsHP[p1Selection];
-                        DrawTextEx(gameFont, "HP:", (Vector2){textLeftMargin, statsStartY}, nameFontSize, fontSpacing, WHITE);
-                        DrawTextEx(gameFont, localizedLabels[hpVal], (Vector2){textLeftMargin + valueOffsetX, statsStartY}, nameFontSize, fontSpacing, statColors[hpVal]);
+                        DrawTextCached(gameFont, lblHP, (Vector2){textLeftMargin, statsStartY}, nameFontSize, fontSpacing, WHITE);
+                        DrawTextCached(gameFont, localizedLabels[hpVal], (Vector2){textLeftMargin + valueOffsetX, statsStartY}, nameFontSize, fontSpacing, statColors[hpVal]);
 
                         int strVal = statsSTR[p1Selection];
-                        DrawTextEx(gameFont, lblSTR, (Vector2){textLeftMargin, statsStartY + lineHeight}, nameFontSize, fontSpacing, WHITE);
-                        DrawTextEx(gameFont, localizedLabels[strVal], (Vector2){textLeftMargin + valueOffsetX, statsStartY + lineHeight}, nameFontSize, fontSpacing, statColors[strVal]);
+                        DrawTextCached(gameFont, lblSTR, (Vector2){textLeftMargin, statsStartY + lineHeight}, nameFontSize, fontSpacing, WHITE);
+                        DrawTextCached(gameFont, localizedLabels[strVal], (Vector2){textLeftMargin + valueOffsetX, statsStartY + lineHeight}, nameFontSize, fontSpacing, statColors[strVal]);
 
                         int spdVal = statsSPD[p1Selection];
-                        DrawTextEx(gameFont, lblSPD, (Vector2){textLeftMargin, statsStartY + (lineHeight * 2)}, nameFontSize, fontSpacing, WHITE);
-                        DrawTextEx(gameFont, localizedLabels[spdVal], (Vector2){textLeftMargin + valueOffsetX, statsStartY + (lineHeight * 2)}, nameFontSize, fontSpacing, statColors[spdVal]);
+                        DrawTextCached(gameFont, lblSPD, (Vector2){textLeftMargin, statsStartY + (lineHeight * 2)}, nameFontSize, fontSpacing, WHITE);
+                        DrawTextCached(gameFont, localizedLabels[spdVal], (Vector2){textLeftMargin + valueOffsetX, statsStartY + (lineHeight * 2)}, nameFontSize, fontSpacing, statColors[spdVal]);
                     }
 
-                    DrawTextEx(gameFont, "P1", (Vector2){infoBoxX + infoBoxW - 40, infoBoxY + infoBoxH - 30}, 23, fontSpacing, RED);
+                    DrawTextCached(gameFont, "P1", (Vector2){infoBoxX + infoBoxW - 40, infoBoxY + infoBoxH - 30}, 23, fontSpacing, RED);
 
                     if (isSelectingP2 || isMultiplayer) {
                         float p2BoxX = 1200 - infoBoxX - infoBoxW; 
@@ -1149,39 +1243,37 @@ int main(void) {
                         float p2TextLeftMargin = p2BoxX + 25;
 
                         if (p2Selection > 1) {
-                            DrawTextEx(gameFont, "???", (Vector2){p2TextLeftMargin, textTopMargin}, nameFontSize, fontSpacing, GRAY);
-                            DrawTextEx(gameFont, "HP:", (Vector2){p2TextLeftMargin, statsStartY}, nameFontSize, fontSpacing, WHITE);
-                            DrawTextEx(gameFont, "???", (Vector2){p2TextLeftMargin + valueOffsetX, statsStartY}, nameFontSize, fontSpacing, GRAY);
-                            DrawTextEx(gameFont, lblSTR, (Vector2){p2TextLeftMargin, statsStartY + lineHeight}, nameFontSize, fontSpacing, WHITE);
-                            DrawTextEx(gameFont, "???", (Vector2){p2TextLeftMargin + valueOffsetX, statsStartY + lineHeight}, nameFontSize, fontSpacing, GRAY);
-                            DrawTextEx(gameFont, lblSPD, (Vector2){p2TextLeftMargin, statsStartY + (lineHeight * 2)}, nameFontSize, fontSpacing, WHITE);
-                            DrawTextEx(gameFont, "???", (Vector2){p2TextLeftMargin + valueOffsetX, statsStartY + (lineHeight * 2)}, nameFontSize, fontSpacing, GRAY);
+                            DrawTextCached(gameFont, "???", (Vector2){p2TextLeftMargin, textTopMargin}, nameFontSize, fontSpacing, GRAY);
+                            DrawTextCached(gameFont, lblHP, (Vector2){p2TextLeftMargin, statsStartY}, nameFontSize, fontSpacing, WHITE);
+                            DrawTextCached(gameFont, "???", (Vector2){p2TextLeftMargin + valueOffsetX, statsStartY}, nameFontSize, fontSpacing, GRAY);
+                            DrawTextCached(gameFont, lblSTR, (Vector2){p2TextLeftMargin, statsStartY + lineHeight}, nameFontSize, fontSpacing, WHITE);
+                            DrawTextCached(gameFont, "???", (Vector2){p2TextLeftMargin + valueOffsetX, statsStartY + lineHeight}, nameFontSize, fontSpacing, GRAY);
+                            DrawTextCached(gameFont, lblSPD, (Vector2){p2TextLeftMargin, statsStartY + (lineHeight * 2)}, nameFontSize, fontSpacing, WHITE);
+                            DrawTextCached(gameFont, "???", (Vector2){p2TextLeftMargin + valueOffsetX, statsStartY + (lineHeight * 2)}, nameFontSize, fontSpacing, GRAY);
                         }
                         else {
-                            const char* p2Txt = namesToUse[p2Selection];
-                            DrawTextEx(gameFont, p2Txt, (Vector2){p2TextLeftMargin, textTopMargin}, nameFontSize, fontSpacing, WHITE);
+                            const char* p2Txt = Loc_GetCharacterName(p2Selection);
+                            DrawTextCached(gameFont, p2Txt, (Vector2){p2TextLeftMargin, textTopMargin}, nameFontSize, fontSpacing, WHITE);
 
                             int hpValP2 = statsHP[p2Selection];
                             int strValP2 = statsSTR[p2Selection];
                             int spdValP2 = statsSPD[p2Selection];
 
-                            DrawTextEx(gameFont, "HP:", (Vector2){p2TextLeftMargin, statsStartY}, nameFontSize, fontSpacing, WHITE);
-                            DrawTextEx(gameFont, localizedLabels[hpValP2], (Vector2){p2TextLeftMargin + valueOffsetX, statsStartY}, nameFontSize, fontSpacing, statColors[hpValP2]);
+                            DrawTextCached(gameFont, lblHP, (Vector2){p2TextLeftMargin, statsStartY}, nameFontSize, fontSpacing, WHITE);
+                            DrawTextCached(gameFont, localizedLabels[hpValP2], (Vector2){p2TextLeftMargin + valueOffsetX, statsStartY}, nameFontSize, fontSpacing, statColors[hpValP2]);
 
-                            DrawTextEx(gameFont, lblSTR, (Vector2){p2TextLeftMargin, statsStartY + lineHeight}, nameFontSize, fontSpacing, WHITE);
-                            DrawTextEx(gameFont, localizedLabels[strValP2], (Vector2){p2TextLeftMargin + valueOffsetX, statsStartY + lineHeight}, nameFontSize, fontSpacing, statColors[strValP2]);
+                            DrawTextCached(gameFont, lblSTR, (Vector2){p2TextLeftMargin, statsStartY + lineHeight}, nameFontSize, fontSpacing, WHITE);
+                            DrawTextCached(gameFont, localizedLabels[strValP2], (Vector2){p2TextLeftMargin + valueOffsetX, statsStartY + lineHeight}, nameFontSize, fontSpacing, statColors[strValP2]);
 
-                            DrawTextEx(gameFont, lblSPD, (Vector2){p2TextLeftMargin, statsStartY + (lineHeight * 2)}, nameFontSize, fontSpacing, WHITE);
-                            DrawTextEx(gameFont, localizedLabels[spdValP2], (Vector2){p2TextLeftMargin + valueOffsetX, statsStartY + (lineHeight * 2)}, nameFontSize, fontSpacing, statColors[spdValP2]);
+                            DrawTextCached(gameFont, lblSPD, (Vector2){p2TextLeftMargin, statsStartY + (lineHeight * 2)}, nameFontSize, fontSpacing, WHITE);
+                            DrawTextCached(gameFont, localizedLabels[spdValP2], (Vector2){p2TextLeftMargin + valueOffsetX, statsStartY + (lineHeight * 2)}, nameFontSize, fontSpacing, statColors[spdValP2]);
                         }
-                        DrawTextEx(gameFont, "P2", (Vector2){p2BoxX + infoBoxW - 40, infoBoxY + infoBoxH - 30}, 23, fontSpacing, BLUE);
+                        DrawTextCached(gameFont, "P2", (Vector2){p2BoxX + infoBoxW - 40, infoBoxY + infoBoxH - 30}, 23, fontSpacing, BLUE);
                     }
                         
-                    const char* instrEN = isSelectingP2 ? "P2: CHOOSE CHARACTER" : "P1: CHOOSE CHARACTER";
-                    const char* instrPT = isSelectingP2 ? "P2: ESCOLHA O PERSONAGEM" : "P1: ESCOLHA O PERSONAGEM";
-                    const char* instr = (settings.language == LANG_EN) ? instrEN : instrPT;
+                    StringID instr = isSelectingP2 ? STR_CSS_P2_CHOOSE : STR_CSS_P1_CHOOSE;
 
-                    DrawTextEx(gameFont, instr, (Vector2){(1200 - MeasureTextEx(gameFont, instr, fontSizeSmall, fontSpacing).x)/2, 690}, fontSizeSmall, fontSpacing, YELLOW);
+                    DrawTextCached(gameFont, Loc_Get(instr), (Vector2){(1200 - Loc_Measure(instr, gameFont, fontSizeSmall, fontSpacing).x)/2, 690}, fontSizeSmall, fontSpacing, YELLOW);
                 }   
                 break;
 
@@ -1197,17 +1289,17 @@ int main(void) {
                     
                     DrawTexturePro(boxArtTex, sourceRec, destRec, origin, rotation, WHITE);
 
-                    const char* textToShow = (settings.language == LANG_EN) ? demo_lock_en : demo_lock_pt;
+                    const char* textToShow = Loc_Get(STR_DEMO_LOCK);
                     
                     Vector2 textPos = { 500, 150 };
                     float fontSizeDemo = mainFont.baseSize * 0.75f;
                     float spacingDemo = 2.0f;
                 
-                    DrawTextEx(mainFont, textToShow, textPos, fontSizeDemo, spacingDemo, WHITE);
+                    DrawTextCached(mainFont, textToShow, textPos, fontSizeDemo, spacingDemo, WHITE);
 
-                    const char* returnTxt = (settings.language == LANG_EN) ? "Press ENTER to Return" : "Pressione ENTER para Voltar";
-                    Vector2 mRet = MeasureTextEx(mainFont, returnTxt, fontSizeOption, spacingDemo);
-                    DrawTextEx(mainFont, returnTxt, (Vector2){(1200 - mRet.x)/2, 650}, fontSizeOption, spacingDemo, YELLOW);
+                    const char* returnTxt = Loc_Get(STR_PRESS_ENTER_RETURN);
+                    Vector2 mRet = Loc_Measure(STR_PRESS_ENTER_RETURN, mainFont, fontSizeOption, spacingDemo);
+                    DrawTextCached(mainFont, returnTxt, (Vector2){(1200 - mRet.x)/2, 650}, fontSizeOption, spacingDemo, YELLOW);
                 }
                 break;
                 
@@ -1215,16 +1307,19 @@ int main(void) {
                     GameScene_Draw();
                     break;
             }
+        EndMode2D();
         EndTextureMode();
 
         BeginDrawing();
             ClearBackground(BLACK);
 
-            Rectangle sourceRect = { 0, 0, (float)target.texture.width, (float)-target.texture.height };
+            Rectangle sourceRect = RenderScale_GetSourceRect(&renderScale);
             Rectangle destRect = { 0, 0, (float)GetScreenWidth(), (float)GetScreenHeight() };
             Vector2 origin = { 0, 0 };
 
             if (currentState == STATE_REVEAL_MM) {
+                float scaledPixelSize = currentPixelSize * RenderScale_Get(&renderScale);
+                SetShaderValue(pixelShader, pixelSizeLoc, &scaledPixelSize, SHADER_UNIFORM_FLOAT);
                 BeginShaderMode(pixelShader);
                     DrawTexturePro(target.texture, sourceRect, destRect, origin, 0.0f, WHITE);
                 EndShaderMode();
@@ -1236,47 +1331,41 @@ int main(void) {
                 DrawRectangle(0, 0, GetScreenWidth(), GetScreenHeight(), (Color){ 0, 0, 0, (unsigned char)fadeAlpha });
             }
 
-        EndDrawing();
+            RenderScale_DrawOverlay(&renderScale, 16, 16);
+            if (renderScale.showOverlay) FramePacing_DrawOverlay(&pacer, 16, 48);
+
+            // Custo de CPU do frame (logica + envio dos comandos), antes do swap
+            float workMs = (float)((GetTime() - frameStartTime) * 1000.0);
+
+        FramePacing_Present(&pacer);
+
+        if (!isFirstFrameLogged) {
+            printf("STARTUP: Primeiro frame em %.1f ms\n", GetTime() * 1000.0);
+            isFirstFrameLogged = true;
+        }
+
+        RenderScale_Update(&renderScale, workMs, FramePacing_GetFrameTime(&pacer) * 1000.0f);
     }
     
     SaveGameSettings(&settings);
 
-    GameScene_Unload();
+    SceneStack_Clear();
+    Character_UnloadMovesets();
+    TextureStream_Shutdown();
     
-    UnloadTexturesInLoop(uniqueTitleBGs, UNIQUE_BG_COUNT);
     UnloadRenderTexture(target);
     UnloadShader(pixelShader);
     UnloadShader(gradientShader);
-    UnloadTexture(mmLogo);
-    UnloadTexture(cesarLogo);
-    UnloadTexture(charSelectBg);
-    UnloadTexture(charBoxTex);
-    UnloadTexture(infoBoxTex);
-    UnloadTexture(lockedBoxTex);
-    UnloadTexture(boxArtTex);
-    UnloadTexture(bactIcon);
-    UnloadTexture(amoebaIcon);
-    UnloadFont(mainFont);
-    UnloadFont(gameFont);
+    UnloadCustomFont(mainFont);
+    UnloadCustomFont(gameFont);
     UnloadImage(icon);
 
-    for (int i = 0; i < MENU_OPTIONS; i++) {
-        UnloadTexture(menuIcons[i]);
-    }
-
-    UnloadTexture(qpIcons[0]);
-    UnloadTexture(qpIcons[1]);
-
-    StopMusicStream(menuMusic);
-    UnloadMusicStream(menuMusic);
-    StopMusicStream(cssMusic);
-    UnloadMusicStream(cssMusic);
-    StopMusicStream(fightMusic);
-    UnloadMusicStream(fightMusic);
+    MusicPlayer_Shutdown();
     UnloadSound(sndSelect);
     UnloadSound(sndSelected);
 
     CloseAudioDevice();
+    Assets_ClosePack();
     CloseWindow();
 
     return 0;
@@ -1327,7 +1416,7 @@ void DrawInitialBackground(int screenWidth, int screenHeight, TitleBG *titleBGs,
     }
 
     for (int i = 0; i < BG_COUNT; i++) {
-        Texture2D tex = titleBGs[i].texture;
+        Texture2D tex = *titleBGs[i].texture;
         float scale = titleBGs[i].scale;
         float texWidth = tex.width * scale;
         float texHeight = tex.height * scale;
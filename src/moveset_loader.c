@@ -1,16 +1,32 @@
 #include "game_scene.h"
+#include "asset_loader.h"
 #include "cJSON.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-static void ParseMove(cJSON *json, Move *move) {
-    if (!json) return;
+// Ultimate em queda: sobe até o pico, paira, depois despenca
+#define ULTIMATE_PEAK_FRAME 40
+#define ULTIMATE_HANG_FRAMES 60
+
+#define TRAIL_INTERVAL_FRAMES 24
 
+// Chave no JSON de cada MoveSlot
+static const char *moveKeys[MOVE_SLOT_COUNT] = {
+    "side_ground", "up_ground", "down_ground", "neutral_ground",
+    "air_side", "air_up", "air_down", "air_neutral",
+    "special_neutral", "special_side", "special_up", "special_down",
+    "ultimate"
+};
+
+static const char *stateKeys[PLAYER_STATE_COUNT] = {
+    "idle", "walk", "jump", "fall", "attack", "hurt", "dead"
+};
+
+static void ParseMove(cJSON *json, Move *move) {
     move->type = MOVE_TYPE_MELEE;
     move->effect = EFFECT_NONE;
-    move->cooldown = 0;
-    move->lastUsedTime = -100.0f;
+    move->cooldownFrames = 0;
     move->trapDuration = 0;
 
     move->selfVelocity = (Vector2){0,0};
@@ -19,9 +35,9 @@ static void ParseMove(cJSON *json, Move *move) {
     move->multiHit = false;
     move->canCombo = false;
     move->maxCombo = 0;
+    move->steerTurns = false;
 
-    cJSON *name = cJSON_GetObjectItem(json, "name");
-    if (name) strncpy(move->name, name->valuestring, 31);
+    if (!json) return;
 
     cJSON *dmg = cJSON_GetObjectItem(json, "damage");
     if (dmg) move->damage = dmg->valuedouble;
@@ -62,7 +78,7 @@ static void ParseMove(cJSON *json, Move *move) {
     if (trapDur) move->trapDuration = (float)trapDur->valuedouble;
 
     cJSON *cd = cJSON_GetObjectItem(json, "cooldown");
-    if (cd) move->cooldown = (float)cd->valuedouble;
+    if (cd) move->cooldownFrames = (int)(cd->valuedouble * SIM_TICK_RATE + 0.5);
 
     cJSON *projSpeed = cJSON_GetObjectItem(json, "projectile_speed");
     if (projSpeed) {
@@ -88,6 +104,9 @@ static void ParseMove(cJSON *json, Move *move) {
     cJSON *combo = cJSON_GetObjectItem(json, "can_combo");
     if (combo) move->canCombo = combo->valueint;
 
+    cJSON *steerTurns = cJSON_GetObjectItem(json, "steer_turns");
+    if (steerTurns) move->steerTurns = steerTurns->valueint;
+
     cJSON *type = cJSON_GetObjectItem(json, "type");
     if (type) {
         if (strcmp(type->valuestring, "PROJECTILE") == 0) move->type = MOVE_TYPE_PROJECTILE;
@@ -101,50 +120,149 @@ static void ParseMove(cJSON *json, Move *move) {
     }
 }
 
+static bool GetFlag(cJSON *json, const char *key) {
+    cJSON *item = cJSON_GetObjectItem(json, key);
+    return item != NULL && cJSON_IsTrue(item);
+}
+
+// Frame 0 é o de início (o golpe é criado); o tick seguinte já é o frame 1.
+// O último frame, um depois da recuperação, encerra o golpe.
+static void CompileTimeline(cJSON *json, Move *move) {
+    int lastFrame = move->startupFrames + move->activeFrames + move->recoveryFrames + 1;
+    move->frameCount = lastFrame + 1;
+    unsigned short *timeline = (unsigned short*)calloc(move->frameCount, sizeof(unsigned short));
+    move->timeline = timeline;
+    if (timeline == NULL) {
+        move->frameCount = 0;
+        return;
+    }
+
+    unsigned short everyFrame = 0;
+    if (move->selfVelocity.x != 0 || move->selfVelocity.y != 0) everyFrame |= MOVE_FRAME_SELF_VELOCITY;
+    if (move->steerSpeed > 0) everyFrame |= MOVE_FRAME_STEER;
+    if (move->selfVelocity.y > 0 || move->fallSpeed > 0) everyFrame |= MOVE_FRAME_LAND_END;
+    if (move->type == MOVE_TYPE_ULTIMATE_FALL) everyFrame |= MOVE_FRAME_LAND_EXPLODE;
+    if (GetFlag(json, "gravity")) everyFrame |= MOVE_FRAME_GRAVITY;
+    if (GetFlag(json, "can_jump")) everyFrame |= MOVE_FRAME_JUMP;
+
+    cJSON *trailItem = cJSON_GetObjectItem(json, "trail_vfx");
+    const char *trail = cJSON_IsString(trailItem) ? trailItem->valuestring : "";
+    int fallStart = ULTIMATE_PEAK_FRAME + ULTIMATE_HANG_FRAMES;
+
+    for (int frame = 0; frame < move->frameCount; frame++) {
+        unsigned short flags = everyFrame;
+
+        if (move->canCombo && frame > move->startupFrames + move->activeFrames) flags |= MOVE_FRAME_CANCEL;
+
+        if (move->type == MOVE_TYPE_ULTIMATE_FALL) {
+            if (frame == ULTIMATE_PEAK_FRAME) flags |= MOVE_FRAME_SPAWN_CLOUD;
+            if (frame >= ULTIMATE_PEAK_FRAME && frame < fallStart) flags |= MOVE_FRAME_HANG;
+            if (frame >= fallStart) flags |= MOVE_FRAME_FALL;
+        }
+
+        if (frame >= 1 && (frame - 1) % TRAIL_INTERVAL_FRAMES == 0) {
+            if (strcmp(trail, "side") == 0) flags |= MOVE_FRAME_TRAIL_SIDE;
+            else if (strcmp(trail, "up") == 0) {
+                // Na queda do ultimate o foguete desce: o rastro sai por cima
+                bool isFalling = (move->type == MOVE_TYPE_ULTIMATE_FALL && frame >= fallStart);
+                flags |= isFalling ? MOVE_FRAME_TRAIL_DOWN : MOVE_FRAME_TRAIL_UP;
+            }
+        }
+
+        timeline[frame] = flags;
+    }
+
+    timeline[0] |= MOVE_FRAME_SPAWN;
+    timeline[lastFrame] |= MOVE_FRAME_END;
+}
+
+static void LoadMove(cJSON *moves, const char *key, Move *move, char *name) {
+    cJSON *json = cJSON_GetObjectItem(moves, key);
+    ParseMove(json, move);
+    CompileTimeline(json, move);
+
+    cJSON *nameItem = cJSON_GetObjectItem(json, "name");
+    if (cJSON_IsString(nameItem)) strncpy(name, nameItem->valuestring, 31);
+}
+
+// Campos ausentes herdam de fallback
+static AnimClip ParseClip(cJSON *json, AnimClip fallback) {
+    AnimClip clip = fallback;
+    if (!json) return clip;
+
+    cJSON *start = cJSON_GetObjectItem(json, "start");
+    if (start) clip.start = start->valueint;
+
+    cJSON *length = cJSON_GetObjectItem(json, "length");
+    if (length) clip.length = length->valueint;
+
+    cJSON *speed = cJSON_GetObjectItem(json, "speed");
+    if (speed) clip.speed = (float)speed->valuedouble;
+
+    cJSON *loop = cJSON_GetObjectItem(json, "loop");
+    if (loop) clip.loop = cJSON_IsTrue(loop);
+
+    return clip;
+}
+
+static void LoadAnimations(cJSON *json, CharacterAnims *anims) {
+    AnimClip base = { 0, 1, 0.12f, true };
+
+    // Sem "dead" fica o idle; golpe sem clipe próprio usa o "attack"
+    anims->states[PLAYER_STATE_IDLE] = ParseClip(cJSON_GetObjectItem(json, "idle"), base);
+    for (int i = 0; i < PLAYER_STATE_COUNT; i++) {
+        if (i == PLAYER_STATE_IDLE) continue;
+        AnimClip fallback = base;
+        if (i == PLAYER_STATE_DEAD) fallback = anims->states[PLAYER_STATE_IDLE];
+        if (i == PLAYER_STATE_ATTACK) { fallback.speed = 0.08f; fallback.loop = false; }
+        anims->states[i] = ParseClip(cJSON_GetObjectItem(json, stateKeys[i]), fallback);
+    }
+
+    cJSON *moves = cJSON_GetObjectItem(json, "moves");
+    for (int i = 0; i < MOVE_SLOT_COUNT; i++) {
+        cJSON *clip = cJSON_GetObjectItem(moves, moveKeys[i]);
+        anims->moves[i] = ParseClip(clip, anims->states[PLAYER_STATE_ATTACK]);
+
+        cJSON *steer = cJSON_GetObjectItem(clip, "steer");
+        if (steer) anims->steering[i] = ParseClip(steer, anims->moves[i]);
+    }
+}
+
 Moveset* LoadMovesetFromJSON(const char *filename) {
-    FILE *f = fopen(filename, "rb");
-    if (!f) {
+    char *data = Assets_LoadText(filename);
+    if (data == NULL) {
         printf("ERRO: Nao foi possivel abrir %s\n", filename);
         return NULL;
     }
-    fseek(f, 0, SEEK_END);
-    long length = ftell(f);
-    fseek(f, 0, SEEK_SET);
-    char *data = (char*)malloc(length + 1);
-    fread(data, 1, length, f);
-    data[length] = '\0';
-    fclose(f);
 
     cJSON *root = cJSON_Parse(data);
     if (!root) {
         printf("ERRO: JSON invalido em %s\n", filename);
-        free(data);
+        Assets_UnloadText(data);
         return NULL;
     }
 
-    Moveset *moveset = (Moveset*)malloc(sizeof(Moveset));
+    Moveset *moveset = (Moveset*)calloc(1, sizeof(Moveset));
     cJSON *moves = cJSON_GetObjectItem(root, "moves");
 
-    ParseMove(cJSON_GetObjectItem(moves, "side_ground"), &moveset->sideGround);
-    ParseMove(cJSON_GetObjectItem(moves, "up_ground"), &moveset->upGround);
-    ParseMove(cJSON_GetObjectItem(moves, "down_ground"), &moveset->downGround);
-    ParseMove(cJSON_GetObjectItem(moves, "neutral_ground"), &moveset->neutralGround);
-    
-    ParseMove(cJSON_GetObjectItem(moves, "air_side"), &moveset->airSide);
-    ParseMove(cJSON_GetObjectItem(moves, "air_up"), &moveset->airUp);
-    ParseMove(cJSON_GetObjectItem(moves, "air_down"), &moveset->airDown);
-    ParseMove(cJSON_GetObjectItem(moves, "air_neutral"), &moveset->airNeutral);
-
-    ParseMove(cJSON_GetObjectItem(moves, "special_neutral"), &moveset->specialNeutral);
-    ParseMove(cJSON_GetObjectItem(moves, "special_side"), &moveset->specialSide);
-    ParseMove(cJSON_GetObjectItem(moves, "special_up"), &moveset->specialUp);
-    ParseMove(cJSON_GetObjectItem(moves, "special_down"), &moveset->specialDown);
-    
-    ParseMove(cJSON_GetObjectItem(moves, "ultimate"), &moveset->ultimate);
+    for (int i = 0; i < MOVE_SLOT_COUNT; i++) {
+        LoadMove(moves, moveKeys[i], &moveset->list[i], moveset->names[i]);
+    }
+
+    LoadAnimations(cJSON_GetObjectItem(root, "animations"), &moveset->anims);
 
     cJSON_Delete(root);
-    free(data);
+    Assets_UnloadText(data);
     
     printf("Moveset do Bacteriofago carregado com sucesso!\n");
     return moveset;
+}
+
+void UnloadMoveset(Moveset *moveset) {
+    if (moveset == NULL) return;
+
+    for (int i = 0; i < MOVE_SLOT_COUNT; i++) {
+        free((void*)moveset->list[i].timeline);
+    }
+    free(moveset);
 }
\ No newline at end of file
@@ -0,0 +1,164 @@
+#include "music_player.h"
+#include "asset_loader.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <time.h>
+
+// Intervalo entre reabastecimentos; bem menor que meio buffer
+#define MUSIC_UPDATE_PERIOD_NS 5000000L
+
+// Frames por metade do buffer do stream (~93 ms a 44.1 kHz), folga para a
+// thread perder a vez no escalonador sem faltar áudio
+#define MUSIC_BUFFER_FRAMES 4096
+
+#define MUSIC_QUEUE_SIZE 32     // potência de 2
+
+typedef enum {
+    MUSIC_COMMAND_PLAY,
+    MUSIC_COMMAND_STOP,
+    MUSIC_COMMAND_VOLUME
+} MusicCommandType;
+
+typedef struct {
+    MusicCommandType type;
+    int track;
+    float volume;
+} MusicCommand;
+
+static Music tracks[MUSIC_PLAYER_MAX_TRACKS];
+static int trackCount = 0;
+
+// Fila de um produtor (thread principal) e um consumidor (thread de música)
+static MusicCommand queue[MUSIC_QUEUE_SIZE];
+static atomic_uint queueHead = 0;       // só o consumidor escreve
+static atomic_uint queueTail = 0;       // só o produtor escreve
+
+static pthread_t musicThread;
+static atomic_bool isRunning = false;
+static bool isThreaded = false;
+
+// Só quem toca as faixas mexe aqui: a thread, ou a principal se ela não subiu
+static int currentTrack = MUSIC_NONE;
+static float currentVolume = 1.0f;
+
+// Espelho na thread principal, para não encher a fila de comandos repetidos
+static int requestedTrack = MUSIC_NONE;
+static float requestedVolume = -1.0f;
+
+static bool PushCommand(MusicCommand command) {
+    unsigned int tail = atomic_load_explicit(&queueTail, memory_order_relaxed);
+    unsigned int head = atomic_load_explicit(&queueHead, memory_order_acquire);
+    if (tail - head >= MUSIC_QUEUE_SIZE) {
+        printf("ERRO: Fila da musica cheia, comando descartado\n");
+        return false;
+    }
+
+    queue[tail & (MUSIC_QUEUE_SIZE - 1)] = command;
+    atomic_store_explicit(&queueTail, tail + 1, memory_order_release);
+    return true;
+}
+
+static bool PopCommand(MusicCommand *command) {
+    unsigned int head = atomic_load_explicit(&queueHead, memory_order_relaxed);
+    unsigned int tail = atomic_load_explicit(&queueTail, memory_order_acquire);
+    if (head == tail) return false;
+
+    *command = queue[head & (MUSIC_QUEUE_SIZE - 1)];
+    atomic_store_explicit(&queueHead, head + 1, memory_order_release);
+    return true;
+}
+
+// Retorna a faixa que fica tocando
+static int RunCommand(MusicCommand command, int current, float *volume) {
+    switch (command.type) {
+        case MUSIC_COMMAND_PLAY:
+            if (current != MUSIC_NONE) StopMusicStream(tracks[current]);
+            SetMusicVolume(tracks[command.track], *volume);
+            PlayMusicStream(tracks[command.track]);
+            return command.track;
+        case MUSIC_COMMAND_STOP:
+            if (current != MUSIC_NONE) StopMusicStream(tracks[current]);
+            return MUSIC_NONE;
+        case MUSIC_COMMAND_VOLUME:
+            *volume = command.volume;
+            if (current != MUSIC_NONE) SetMusicVolume(tracks[current], *volume);
+            return current;
+    }
+    return current;
+}
+
+static void PumpMusic(void) {
+    MusicCommand command;
+    while (PopCommand(&command)) currentTrack = RunCommand(command, currentTrack, &currentVolume);
+
+    if (currentTrack != MUSIC_NONE) UpdateMusicStream(tracks[currentTrack]);
+}
+
+static void *MusicThreadMain(void *arg) {
+    (void)arg;
+    const struct timespec period = { 0, MUSIC_UPDATE_PERIOD_NS };
+
+    while (atomic_load_explicit(&isRunning, memory_order_acquire)) {
+        PumpMusic();
+        nanosleep(&period, NULL);
+    }
+    return NULL;
+}
+
+void MusicPlayer_Init(void) {
+    atomic_store(&isRunning, true);
+    isThreaded = (pthread_create(&musicThread, NULL, MusicThreadMain, NULL) == 0);
+    if (!isThreaded) {
+        printf("ERRO: Nao foi possivel criar a thread de musica, tocando na thread principal\n");
+        atomic_store(&isRunning, false);
+    }
+}
+
+void MusicPlayer_Update(void) {
+    if (!isThreaded) PumpMusic();
+}
+
+void MusicPlayer_Shutdown(void) {
+    if (isThreaded && atomic_exchange(&isRunning, false)) pthread_join(musicThread, NULL);
+    isThreaded = false;
+
+    if (currentTrack != MUSIC_NONE) StopMusicStream(tracks[currentTrack]);
+    currentTrack = MUSIC_NONE;
+
+    for (int i = 0; i < trackCount; i++) UnloadMusicStream(tracks[i]);
+    trackCount = 0;
+    requestedTrack = MUSIC_NONE;
+}
+
+int MusicPlayer_Load(const char *fileName, bool looping) {
+    if (trackCount >= MUSIC_PLAYER_MAX_TRACKS) {
+        printf("ERRO: Limite de faixas atingido, %s ignorada\n", fileName);
+        return MUSIC_NONE;
+    }
+
+    SetAudioStreamBufferSizeDefault(MUSIC_BUFFER_FRAMES);
+    Music music = Assets_LoadMusic(fileName);
+    SetAudioStreamBufferSizeDefault(0);
+    if (music.stream.buffer == NULL) return MUSIC_NONE;
+
+    // Publicada para a thread junto com o primeiro comando que a usa
+    music.looping = looping;
+    tracks[trackCount] = music;
+    return trackCount++;
+}
+
+void MusicPlayer_Play(int track) {
+    if (track < 0 || track >= trackCount || track == requestedTrack) return;
+    if (PushCommand((MusicCommand){ MUSIC_COMMAND_PLAY, track, 0.0f })) requestedTrack = track;
+}
+
+void MusicPlayer_Stop(void) {
+    if (requestedTrack == MUSIC_NONE) return;
+    if (PushCommand((MusicCommand){ MUSIC_COMMAND_STOP, MUSIC_NONE, 0.0f })) requestedTrack = MUSIC_NONE;
+}
+
+void MusicPlayer_SetVolume(float volume) {
+    if (volume == requestedVolume) return;
+    if (PushCommand((MusicCommand){ MUSIC_COMMAND_VOLUME, MUSIC_NONE, volume })) requestedVolume = volume;
+}
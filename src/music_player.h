@@ -0,0 +1,27 @@
+#ifndef MUSIC_PLAYER_H
+#define MUSIC_PLAYER_H
+
+#include "raylib.h"
+
+#define MUSIC_PLAYER_MAX_TRACKS 8
+#define MUSIC_NONE -1
+
+// --- PROTÓTIPOS DE FUNÇÕES ---
+
+// A decodificação e o reabastecimento do stream rodam numa thread própria:
+// um frame travado (carregamento, shader) não faz mais a música engasgar.
+// Depois do Init a thread principal só fala com as faixas pelos comandos
+// abaixo, que nunca bloqueiam.
+void MusicPlayer_Init(void);
+void MusicPlayer_Update(void);          // uma vez por frame; só trabalha se a thread não pôde ser criada
+void MusicPlayer_Shutdown(void);        // para a thread e descarrega as faixas (antes do CloseAudioDevice)
+
+// Retorna o id da faixa, ou MUSIC_NONE se não carregou
+int MusicPlayer_Load(const char *fileName, bool looping);
+
+// Para a faixa atual e toca esta do início; não faz nada se ela já está tocando
+void MusicPlayer_Play(int track);
+void MusicPlayer_Stop(void);
+void MusicPlayer_SetVolume(float volume);
+
+#endif
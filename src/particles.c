@@ -0,0 +1,384 @@
+#include "particles.h"
+#include "asset_loader.h"
+#include "cJSON.h"
+#include "rlgl.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DRAW_CHUNK_QUADS 1024
+
+typedef struct {
+    char name[32];
+    int texture;
+    int frames;
+    float frameTime;
+    float lifetime;
+    float fadeTime;
+    float scale;
+    int count;
+    float speedMin;
+    float speedMax;
+    float spread;
+    float gravity;
+    float drag;
+    float spin;
+    bool isOrbit;
+    bool alignToOrbit;
+    float orbitRadius;
+    float orbitGrowth;
+    float orbitSpeed;
+    Color tint;
+
+    // Calculados na carga a partir da textura
+    float frameWidth;
+    float frameHeight;
+    float uStep;
+} EmitterDef;
+
+// Estrutura de arrays: o update só toca nos campos que usa e remover é
+// trocar a última partícula para o buraco, sem malloc por efeito.
+typedef struct {
+    int count;
+    float posX[PARTICLE_CAPACITY];
+    float posY[PARTICLE_CAPACITY];
+    float velX[PARTICLE_CAPACITY];
+    float velY[PARTICLE_CAPACITY];
+    float dirX[PARTICLE_CAPACITY];
+    float dirY[PARTICLE_CAPACITY];
+    float radius[PARTICLE_CAPACITY];
+    float rotation[PARTICLE_CAPACITY];
+    float age[PARTICLE_CAPACITY];
+    float life[PARTICLE_CAPACITY];
+    unsigned char emitter[PARTICLE_CAPACITY];
+} ParticlePool;
+
+static ParticlePool pool;
+static EmitterDef emitters[PARTICLE_MAX_EMITTERS];
+static int emitterCount = 0;
+static Texture2D textures[PARTICLE_MAX_TEXTURES];
+static char texturePaths[PARTICLE_MAX_TEXTURES][128];
+static int textureCount = 0;
+static unsigned short drawOrder[PARTICLE_CAPACITY];
+
+static float RandomRange(float min, float max) {
+    return min + (max - min) * (GetRandomValue(0, 10000) / 10000.0f);
+}
+
+static float GetNumber(cJSON *json, const char *key, float fallback) {
+    cJSON *item = cJSON_GetObjectItem(json, key);
+    return cJSON_IsNumber(item) ? (float)item->valuedouble : fallback;
+}
+
+static int LoadParticleTexture(const char *path) {
+    for (int i = 0; i < textureCount; i++) {
+        if (strcmp(texturePaths[i], path) == 0) return i;
+    }
+
+    if (textureCount >= PARTICLE_MAX_TEXTURES) {
+        printf("PARTICULAS: Limite de texturas atingido (%s)\n", path);
+        return -1;
+    }
+
+    Texture2D tex = Assets_LoadTexture(path);
+    if (tex.id == 0) return -1;
+    SetTextureFilter(tex, TEXTURE_FILTER_POINT);
+
+    textures[textureCount] = tex;
+    strncpy(texturePaths[textureCount], path, sizeof(texturePaths[0]) - 1);
+    texturePaths[textureCount][sizeof(texturePaths[0]) - 1] = '\0';
+    return textureCount++;
+}
+
+static void ParseEmitter(cJSON *json, EmitterDef *def) {
+    memset(def, 0, sizeof(*def));
+
+    cJSON *name = cJSON_GetObjectItem(json, "name");
+    if (cJSON_IsString(name)) strncpy(def->name, name->valuestring, sizeof(def->name) - 1);
+
+    cJSON *texture = cJSON_GetObjectItem(json, "texture");
+    def->texture = cJSON_IsString(texture) ? LoadParticleTexture(texture->valuestring) : -1;
+
+    def->frames = (int)GetNumber(json, "frames", 1);
+    if (def->frames < 1) def->frames = 1;
+    def->frameTime = GetNumber(json, "frame_time", 0.0f);
+
+    // Sem lifetime explícito a partícula vive exatamente uma passada da animação
+    def->lifetime = GetNumber(json, "lifetime", def->frames * def->frameTime);
+    if (def->lifetime <= 0.0f) def->lifetime = 1.0f;
+
+    def->fadeTime = GetNumber(json, "fade_time", 0.0f);
+    def->scale = GetNumber(json, "scale", 1.0f);
+    def->count = (int)GetNumber(json, "count", 1);
+    if (def->count < 1) def->count = 1;
+
+    def->speedMin = GetNumber(json, "speed_min", 0.0f);
+    def->speedMax = GetNumber(json, "speed_max", def->speedMin);
+    def->spread = GetNumber(json, "spread", 0.0f);
+    def->gravity = GetNumber(json, "gravity", 0.0f);
+    def->drag = GetNumber(json, "drag", 0.0f);
+    def->spin = GetNumber(json, "spin", 0.0f);
+
+    cJSON *orbit = cJSON_GetObjectItem(json, "orbit");
+    if (orbit) {
+        def->isOrbit = true;
+        def->orbitRadius = GetNumber(orbit, "radius", 0.0f);
+        def->orbitGrowth = GetNumber(orbit, "growth", 0.0f);
+        def->orbitSpeed = GetNumber(orbit, "speed", 0.0f);
+        def->alignToOrbit = cJSON_IsTrue(cJSON_GetObjectItem(orbit, "align"));
+    }
+
+    def->tint = WHITE;
+    cJSON *tint = cJSON_GetObjectItem(json, "tint");
+    if (cJSON_IsArray(tint) && cJSON_GetArraySize(tint) == 4) {
+        def->tint.r = (unsigned char)cJSON_GetArrayItem(tint, 0)->valueint;
+        def->tint.g = (unsigned char)cJSON_GetArrayItem(tint, 1)->valueint;
+        def->tint.b = (unsigned char)cJSON_GetArrayItem(tint, 2)->valueint;
+        def->tint.a = (unsigned char)cJSON_GetArrayItem(tint, 3)->valueint;
+    }
+
+    if (def->texture >= 0) {
+        Texture2D tex = textures[def->texture];
+        int frameWidth = tex.width / def->frames;
+        def->frameWidth = (float)frameWidth;
+        def->frameHeight = (float)tex.height;
+        def->uStep = (float)frameWidth / (float)tex.width;
+    }
+}
+
+bool Particles_Load(const char *filename) {
+    Particles_Unload();
+
+    char *data = Assets_LoadText(filename);
+    if (data == NULL) {
+        printf("ERRO: Nao foi possivel abrir %s\n", filename);
+        return false;
+    }
+
+    cJSON *root = cJSON_Parse(data);
+    if (!root) {
+        printf("ERRO: JSON invalido em %s\n", filename);
+        Assets_UnloadText(data);
+        return false;
+    }
+
+    cJSON *list = cJSON_GetObjectItem(root, "emitters");
+    cJSON *item = NULL;
+    cJSON_ArrayForEach(item, list) {
+        if (emitterCount >= PARTICLE_MAX_EMITTERS) {
+            printf("PARTICULAS: Limite de emissores atingido\n");
+            break;
+        }
+
+        EmitterDef *def = &emitters[emitterCount];
+        ParseEmitter(item, def);
+        if (def->texture < 0) {
+            printf("PARTICULAS: Emissor '%s' sem textura valida\n", def->name);
+            continue;
+        }
+        emitterCount++;
+    }
+
+    cJSON_Delete(root);
+    Assets_UnloadText(data);
+
+    printf("PARTICULAS: %d emissores, %d texturas\n", emitterCount, textureCount);
+    return true;
+}
+
+void Particles_Unload(void) {
+    for (int i = 0; i < textureCount; i++) {
+        UnloadTexture(textures[i]);
+    }
+    textureCount = 0;
+    emitterCount = 0;
+    pool.count = 0;
+}
+
+int Particles_FindEmitter(const char *name) {
+    for (int i = 0; i < emitterCount; i++) {
+        if (strcmp(emitters[i].name, name) == 0) return i;
+    }
+    printf("PARTICULAS: Emissor '%s' nao encontrado\n", name);
+    return -1;
+}
+
+void Particles_Emit(int emitter, Vector2 position, float rotation) {
+    if (emitter < 0 || emitter >= emitterCount) return;
+    const EmitterDef *def = &emitters[emitter];
+
+    for (int n = 0; n < def->count; n++) {
+        // Pool cheio: descarta o excesso em vez de crescer
+        if (pool.count >= PARTICLE_CAPACITY) return;
+        int i = pool.count++;
+
+        pool.posX[i] = position.x;
+        pool.posY[i] = position.y;
+        pool.rotation[i] = rotation;
+        pool.age[i] = 0.0f;
+        pool.life[i] = def->lifetime;
+        pool.emitter[i] = (unsigned char)emitter;
+
+        if (def->isOrbit) {
+            // Distribui as partículas igualmente ao redor do centro
+            float angle = (rotation + n * (360.0f / def->count)) * DEG2RAD;
+            pool.dirX[i] = cosf(angle);
+            pool.dirY[i] = sinf(angle);
+            pool.radius[i] = def->orbitRadius;
+            pool.velX[i] = 0.0f;
+            pool.velY[i] = 0.0f;
+        } else {
+            float angle = (rotation + RandomRange(-def->spread, def->spread) * 0.5f) * DEG2RAD;
+            float speed = RandomRange(def->speedMin, def->speedMax);
+            pool.dirX[i] = 1.0f;
+            pool.dirY[i] = 0.0f;
+            pool.radius[i] = 0.0f;
+            pool.velX[i] = cosf(angle) * speed;
+            pool.velY[i] = sinf(angle) * speed;
+        }
+    }
+}
+
+static void KillParticle(int i) {
+    int last = --pool.count;
+    if (i == last) return;
+
+    pool.posX[i] = pool.posX[last];
+    pool.posY[i] = pool.posY[last];
+    pool.velX[i] = pool.velX[last];
+    pool.velY[i] = pool.velY[last];
+    pool.dirX[i] = pool.dirX[last];
+    pool.dirY[i] = pool.dirY[last];
+    pool.radius[i] = pool.radius[last];
+    pool.rotation[i] = pool.rotation[last];
+    pool.age[i] = pool.age[last];
+    pool.life[i] = pool.life[last];
+    pool.emitter[i] = pool.emitter[last];
+}
+
+void Particles_Update(float dt) {
+    // A rotação da órbita é a mesma para todo o emissor: um cos/sin por tick
+    float stepCos[PARTICLE_MAX_EMITTERS];
+    float stepSin[PARTICLE_MAX_EMITTERS];
+    for (int e = 0; e < emitterCount; e++) {
+        stepCos[e] = cosf(emitters[e].orbitSpeed * dt);
+        stepSin[e] = sinf(emitters[e].orbitSpeed * dt);
+    }
+
+    int i = 0;
+    while (i < pool.count) {
+        pool.age[i] += dt;
+        if (pool.age[i] >= pool.life[i]) {
+            KillParticle(i);
+            continue;
+        }
+
+        int e = pool.emitter[i];
+        const EmitterDef *def = &emitters[e];
+
+        pool.velY[i] += def->gravity * dt;
+        if (def->drag > 0.0f) {
+            float damping = 1.0f - def->drag * dt;
+            if (damping < 0.0f) damping = 0.0f;
+            pool.velX[i] *= damping;
+            pool.velY[i] *= damping;
+        }
+
+        pool.posX[i] += pool.velX[i] * dt;
+        pool.posY[i] += pool.velY[i] * dt;
+        pool.rotation[i] += def->spin * dt;
+
+        if (def->isOrbit) {
+            float x = pool.dirX[i];
+            float y = pool.dirY[i];
+            pool.dirX[i] = x * stepCos[e] - y * stepSin[e];
+            pool.dirY[i] = x * stepSin[e] + y * stepCos[e];
+            pool.radius[i] += def->orbitGrowth * dt;
+        }
+
+        i++;
+    }
+}
+
+static void PushParticleQuad(int i) {
+    const EmitterDef *def = &emitters[pool.emitter[i]];
+
+    int frame = (def->frameTime > 0.0f) ? (int)(pool.age[i] / def->frameTime)
+                                        : (int)(pool.age[i] / pool.life[i] * def->frames);
+    if (frame >= def->frames) frame = def->frames - 1;
+
+    float u0 = frame * def->uStep;
+    float u1 = u0 + def->uStep;
+    float halfW = def->frameWidth * def->scale * 0.5f;
+    float halfH = def->frameHeight * def->scale * 0.5f;
+
+    float cx = pool.posX[i];
+    float cy = pool.posY[i];
+    float c = 1.0f;
+    float s = 0.0f;
+
+    if (def->isOrbit) {
+        cx += pool.dirX[i] * pool.radius[i];
+        cy += pool.dirY[i] * pool.radius[i];
+    }
+
+    if (def->alignToOrbit) {
+        c = pool.dirX[i];
+        s = pool.dirY[i];
+    } else if (pool.rotation[i] != 0.0f) {
+        c = cosf(pool.rotation[i] * DEG2RAD);
+        s = sinf(pool.rotation[i] * DEG2RAD);
+    }
+
+    float alpha = 1.0f;
+    float remaining = pool.life[i] - pool.age[i];
+    if (def->fadeTime > 0.0f && remaining < def->fadeTime) alpha = remaining / def->fadeTime;
+
+    rlColor4ub(def->tint.r, def->tint.g, def->tint.b, (unsigned char)(def->tint.a * alpha));
+
+    // Mesma ordem de vértices do DrawTexturePro: TL, BL, BR, TR
+    rlTexCoord2f(u0, 0.0f); rlVertex2f(cx - halfW * c + halfH * s, cy - halfW * s - halfH * c);
+    rlTexCoord2f(u0, 1.0f); rlVertex2f(cx - halfW * c - halfH * s, cy - halfW * s + halfH * c);
+    rlTexCoord2f(u1, 1.0f); rlVertex2f(cx + halfW * c - halfH * s, cy + halfW * s + halfH * c);
+    rlTexCoord2f(u1, 0.0f); rlVertex2f(cx + halfW * c + halfH * s, cy + halfW * s - halfH * c);
+}
+
+void Particles_Draw(void) {
+    if (pool.count == 0) return;
+
+    // Ordena por textura (counting sort) para trocar de textura uma vez por grupo
+    int groupStart[PARTICLE_MAX_TEXTURES + 1] = { 0 };
+    for (int i = 0; i < pool.count; i++) {
+        groupStart[emitters[pool.emitter[i]].texture + 1]++;
+    }
+    for (int t = 0; t < textureCount; t++) {
+        groupStart[t + 1] += groupStart[t];
+    }
+
+    int groupFill[PARTICLE_MAX_TEXTURES];
+    memcpy(groupFill, groupStart, sizeof(groupFill));
+    for (int i = 0; i < pool.count; i++) {
+        drawOrder[groupFill[emitters[pool.emitter[i]].texture]++] = (unsigned short)i;
+    }
+
+    for (int t = 0; t < textureCount; t++) {
+        for (int first = groupStart[t]; first < groupStart[t + 1]; first += DRAW_CHUNK_QUADS) {
+            int last = first + DRAW_CHUNK_QUADS;
+            if (last > groupStart[t + 1]) last = groupStart[t + 1];
+
+            rlCheckRenderBatchLimit(4 * (last - first));
+            rlSetTexture(textures[t].id);
+            rlBegin(RL_QUADS);
+                for (int k = first; k < last; k++) {
+                    PushParticleQuad(drawOrder[k]);
+                }
+            rlEnd();
+        }
+    }
+    rlSetTexture(0);
+}
+
+void Particles_Clear(void) {
+    pool.count = 0;
+}
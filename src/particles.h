@@ -0,0 +1,24 @@
+#ifndef PARTICLES_H
+#define PARTICLES_H
+
+#include "raylib.h"
+
+#define PARTICLE_CAPACITY 4096
+#define PARTICLE_MAX_EMITTERS 32
+#define PARTICLE_MAX_TEXTURES 16
+
+// --- PROTÓTIPOS DE FUNÇÕES ---
+
+// Lê as definições de emissores (assets/data/particles.json) e carrega as texturas
+bool Particles_Load(const char *filename);
+void Particles_Unload(void);
+
+// Retorna -1 se o emissor não existir; Particles_Emit ignora ids inválidos
+int Particles_FindEmitter(const char *name);
+void Particles_Emit(int emitter, Vector2 position, float rotation);
+
+void Particles_Update(float dt);
+void Particles_Draw(void);
+void Particles_Clear(void);
+
+#endif
@@ -0,0 +1,136 @@
+#include "render_scale.h"
+#include <stdio.h>
+
+#define FRAME_BUDGET_MS (1000.0f / 60.0f)
+
+// Histerese: limiares diferentes para descer e subir, e um tempo minimo
+// entre trocas, para a escala nao ficar oscilando entre dois degraus.
+#define DOWNSCALE_THRESHOLD 0.85f
+#define UPSCALE_THRESHOLD 0.60f
+#define DOWNSCALE_FRAMES 10
+#define UPSCALE_FRAMES 120
+#define STEP_COOLDOWN 45
+
+static const float renderScaleSteps[RENDER_SCALE_STEPS] = { 1.0f, 0.85f, 0.75f, 0.6f, 0.5f };
+
+static void ClearHistory(RenderScaleController *ctrl) {
+    ctrl->historyIndex = 0;
+    ctrl->historyCount = 0;
+    ctrl->averageMs = 0.0f;
+    ctrl->framesOverBudget = 0;
+    ctrl->framesUnderBudget = 0;
+}
+
+void RenderScale_Init(RenderScaleController *ctrl, int baseWidth, int baseHeight) {
+    ctrl->baseWidth = baseWidth;
+    ctrl->baseHeight = baseHeight;
+    ctrl->step = 0;
+    ctrl->cooldown = 0;
+    ctrl->showOverlay = false;
+    ClearHistory(ctrl);
+}
+
+void RenderScale_Reset(RenderScaleController *ctrl) {
+    ClearHistory(ctrl);
+    ctrl->cooldown = STEP_COOLDOWN;
+}
+
+void RenderScale_Update(RenderScaleController *ctrl, float workMs, float frameMs) {
+    float sample = workMs;
+
+    // Se o frame inteiro estourou o orcamento, o driver segurou o swap
+    // (GPU atrasada): conta o periodo real, nao so o tempo de CPU.
+    if (frameMs > FRAME_BUDGET_MS * 1.05f && frameMs > sample) sample = frameMs;
+
+    // Um unico frame de carregamento nao deve derrubar a media sozinho
+    if (sample > FRAME_BUDGET_MS * 2.0f) sample = FRAME_BUDGET_MS * 2.0f;
+
+    ctrl->frameTimes[ctrl->historyIndex] = sample;
+    ctrl->historyIndex = (ctrl->historyIndex + 1) % RENDER_SCALE_HISTORY;
+    if (ctrl->historyCount < RENDER_SCALE_HISTORY) ctrl->historyCount++;
+
+    float sum = 0.0f;
+    for (int i = 0; i < ctrl->historyCount; i++) sum += ctrl->frameTimes[i];
+    ctrl->averageMs = sum / ctrl->historyCount;
+
+    if (ctrl->cooldown > 0) {
+        ctrl->cooldown--;
+        return;
+    }
+    if (ctrl->historyCount < RENDER_SCALE_HISTORY) return;
+
+    if (ctrl->averageMs > FRAME_BUDGET_MS * DOWNSCALE_THRESHOLD) {
+        ctrl->framesOverBudget++;
+        ctrl->framesUnderBudget = 0;
+    } else if (ctrl->averageMs < FRAME_BUDGET_MS * UPSCALE_THRESHOLD) {
+        ctrl->framesUnderBudget++;
+        ctrl->framesOverBudget = 0;
+    } else {
+        ctrl->framesOverBudget = 0;
+        ctrl->framesUnderBudget = 0;
+    }
+
+    if (ctrl->framesOverBudget >= DOWNSCALE_FRAMES && ctrl->step < RENDER_SCALE_STEPS - 1) {
+        ctrl->step++;
+        printf("RENDER: Escala reduzida para %.0f%% (media %.1f ms)\n", renderScaleSteps[ctrl->step] * 100, ctrl->averageMs);
+        RenderScale_Reset(ctrl);
+    }
+    else if (ctrl->framesUnderBudget >= UPSCALE_FRAMES && ctrl->step > 0) {
+        // Estima o custo no degrau de cima (proporcional a area) antes de subir
+        float current = renderScaleSteps[ctrl->step];
+        float next = renderScaleSteps[ctrl->step - 1];
+        float predicted = ctrl->averageMs * (next * next) / (current * current);
+
+        if (predicted < FRAME_BUDGET_MS * DOWNSCALE_THRESHOLD) {
+            ctrl->step--;
+            printf("RENDER: Escala aumentada para %.0f%% (media %.1f ms)\n", renderScaleSteps[ctrl->step] * 100, ctrl->averageMs);
+            RenderScale_Reset(ctrl);
+        } else {
+            ctrl->framesUnderBudget = 0;
+        }
+    }
+}
+
+float RenderScale_Get(const RenderScaleController *ctrl) {
+    return renderScaleSteps[ctrl->step];
+}
+
+Vector2 RenderScale_GetRenderSize(const RenderScaleController *ctrl) {
+    float scale = renderScaleSteps[ctrl->step];
+    return (Vector2){ (float)(int)(ctrl->baseWidth * scale), (float)(int)(ctrl->baseHeight * scale) };
+}
+
+// A cena e desenhada no canto inferior esquerdo do target (em coordenadas do
+// framebuffer), assim gl_FragCoord dos shaders continua comecando em (0,0).
+Camera2D RenderScale_GetCamera(const RenderScaleController *ctrl) {
+    Vector2 size = RenderScale_GetRenderSize(ctrl);
+    Camera2D camera = { 0 };
+    camera.offset = (Vector2){ 0.0f, ctrl->baseHeight - size.y };
+    camera.target = (Vector2){ 0.0f, 0.0f };
+    camera.rotation = 0.0f;
+    camera.zoom = RenderScale_Get(ctrl);
+    return camera;
+}
+
+Rectangle RenderScale_GetSourceRect(const RenderScaleController *ctrl) {
+    Vector2 size = RenderScale_GetRenderSize(ctrl);
+    return (Rectangle){ 0.0f, 0.0f, size.x, -size.y };
+}
+
+void RenderScale_BeginScissor(const RenderScaleController *ctrl, int x, int y, int width, int height) {
+    float scale = RenderScale_Get(ctrl);
+    Vector2 size = RenderScale_GetRenderSize(ctrl);
+    float offsetY = ctrl->baseHeight - size.y;
+
+    BeginScissorMode((int)(x * scale), (int)(y * scale + offsetY), (int)(width * scale), (int)(height * scale));
+}
+
+void RenderScale_DrawOverlay(const RenderScaleController *ctrl, int posX, int posY) {
+    if (!ctrl->showOverlay) return;
+
+    Vector2 size = RenderScale_GetRenderSize(ctrl);
+    const char *text = TextFormat("RENDER %3.0f%%  %dx%d  %5.1f ms", RenderScale_Get(ctrl) * 100, (int)size.x, (int)size.y, ctrl->averageMs);
+
+    DrawRectangle(posX - 6, posY - 4, MeasureText(text, 20) + 12, 28, (Color){ 0, 0, 0, 180 });
+    DrawText(text, posX, posY, 20, (ctrl->step == 0) ? LIME : ORANGE);
+}
@@ -0,0 +1,38 @@
+#ifndef RENDER_SCALE_H
+#define RENDER_SCALE_H
+
+#include "raylib.h"
+
+#define RENDER_SCALE_STEPS 5
+#define RENDER_SCALE_HISTORY 30
+
+// Controlador de resolução dinâmica: mede o custo dos frames recentes e
+// reduz/aumenta a resolução interna do `target` em degraus.
+typedef struct {
+    int baseWidth;
+    int baseHeight;
+    int step;
+
+    float frameTimes[RENDER_SCALE_HISTORY];
+    int historyIndex;
+    int historyCount;
+    float averageMs;
+
+    int framesOverBudget;
+    int framesUnderBudget;
+    int cooldown;
+
+    bool showOverlay;
+} RenderScaleController;
+
+void RenderScale_Init(RenderScaleController *ctrl, int baseWidth, int baseHeight);
+void RenderScale_Update(RenderScaleController *ctrl, float workMs, float frameMs);
+void RenderScale_Reset(RenderScaleController *ctrl);
+float RenderScale_Get(const RenderScaleController *ctrl);
+Camera2D RenderScale_GetCamera(const RenderScaleController *ctrl);
+Rectangle RenderScale_GetSourceRect(const RenderScaleController *ctrl);
+Vector2 RenderScale_GetRenderSize(const RenderScaleController *ctrl);
+void RenderScale_BeginScissor(const RenderScaleController *ctrl, int x, int y, int width, int height);
+void RenderScale_DrawOverlay(const RenderScaleController *ctrl, int posX, int posY);
+
+#endif
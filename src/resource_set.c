@@ -0,0 +1,48 @@
+#include "resource_set.h"
+#include "texture_stream.h"
+#include <stdio.h>
+
+void ResourceSet_AddTexture(ResourceSet *set, Texture2D *target, const char *fileName, int filter, int wrap) {
+    if (set->textureCount >= RESOURCE_SET_CAPACITY) {
+        printf("ERRO: Conjunto '%s' cheio, %s ignorada\n", set->name, fileName);
+        return;
+    }
+
+    *target = (Texture2D){ 0 };
+    set->textures[set->textureCount++] = (ResourceTexture){ target, fileName, filter, wrap };
+}
+
+void ResourceSet_Request(ResourceSet *set, int priority) {
+    if (set->isRequested) return;
+
+    for (int i = 0; i < set->textureCount; i++) {
+        const ResourceTexture *texture = &set->textures[i];
+        TextureStream_Request(texture->target, texture->fileName, priority, texture->filter, texture->wrap);
+    }
+    set->priority = priority;
+    set->isRequested = true;
+}
+
+void ResourceSet_Finish(ResourceSet *set) {
+    ResourceSet_Request(set, RESOURCE_PRIORITY_NOW);
+    if (!ResourceSet_IsResident(set)) TextureStream_Finish(set->priority);
+}
+
+bool ResourceSet_IsResident(const ResourceSet *set) {
+    if (!set->isRequested) return false;
+
+    for (int i = 0; i < set->textureCount; i++) {
+        if (TextureStream_IsPending(set->textures[i].target)) return false;
+    }
+    return true;
+}
+
+void ResourceSet_Release(ResourceSet *set) {
+    for (int i = 0; i < set->textureCount; i++) {
+        Texture2D *target = set->textures[i].target;
+        TextureStream_Cancel(target);
+        if (target->id != 0) UnloadTexture(*target);
+        *target = (Texture2D){ 0 };
+    }
+    set->isRequested = false;
+}
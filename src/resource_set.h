@@ -0,0 +1,44 @@
+#ifndef RESOURCE_SET_H
+#define RESOURCE_SET_H
+
+#include "raylib.h"
+
+#define RESOURCE_SET_CAPACITY 32
+
+// Prioridades no TextureStream: a cena atual passa na frente da pré-carga
+#define RESOURCE_PRIORITY_NOW 0
+#define RESOURCE_PRIORITY_PREFETCH 1
+
+// --- STRUCTS ---
+
+typedef struct {
+    Texture2D *target;
+    const char *fileName;       // precisa viver tanto quanto o conjunto
+    int filter;
+    int wrap;
+} ResourceTexture;
+
+// Texturas que entram e saem de memória juntas (as de uma cena)
+typedef struct {
+    const char *name;
+    ResourceTexture textures[RESOURCE_SET_CAPACITY];
+    int textureCount;
+    int priority;
+    bool isRequested;
+} ResourceSet;
+
+// --- PROTÓTIPOS DE FUNÇÕES ---
+
+void ResourceSet_AddTexture(ResourceSet *set, Texture2D *target, const char *fileName, int filter, int wrap);
+
+// Começa a decodificar em segundo plano; não faz nada se já foi pedido
+void ResourceSet_Request(ResourceSet *set, int priority);
+
+// Bloqueia até o conjunto inteiro estar na GPU (pede antes, se preciso)
+void ResourceSet_Finish(ResourceSet *set);
+bool ResourceSet_IsResident(const ResourceSet *set);
+
+// Cancela o que ainda não chegou e descarrega o resto
+void ResourceSet_Release(ResourceSet *set);
+
+#endif
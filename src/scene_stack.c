@@ -0,0 +1,81 @@
+#include "scene_stack.h"
+#include <stdio.h>
+
+static const Scene *stack[SCENE_STACK_DEPTH];
+static int depth = 0;
+static const Scene *prefetched = NULL;
+
+static void CallHook(void (*hook)(void)) {
+    if (hook != NULL) hook();
+}
+
+static int FindScene(const Scene *scene) {
+    for (int i = 0; i < depth; i++) {
+        if (stack[i] == scene) return i;
+    }
+    return -1;
+}
+
+static void PopScene(void) {
+    depth--;
+    CallHook(stack[depth]->unload);
+}
+
+// Pré-carga trocada por outra (ou nunca usada): devolve a memória
+static void DropPrefetch(const Scene *keep) {
+    if (prefetched != NULL && prefetched != keep && FindScene(prefetched) < 0) {
+        CallHook(prefetched->unload);
+    }
+    prefetched = NULL;
+}
+
+const Scene *SceneStack_Top(void) {
+    return (depth > 0) ? stack[depth - 1] : NULL;
+}
+
+void SceneStack_Goto(const Scene *scene) {
+    const Scene *top = SceneStack_Top();
+    if (scene == NULL || scene == top) return;
+
+    printf("CENAS: %s -> %s\n", (top != NULL) ? top->name : "-", scene->name);
+    if (scene == prefetched) prefetched = NULL;
+
+    int index = FindScene(scene);
+    if (index >= 0) {
+        while (depth > index + 1) PopScene();
+        CallHook(scene->resume);
+        return;
+    }
+
+    if (top != NULL) {
+        if (top->isTransient) PopScene();
+        else CallHook(top->suspend);
+    }
+
+    if (depth >= SCENE_STACK_DEPTH) {
+        printf("ERRO: Pilha de cenas cheia, %s descartada\n", stack[depth - 1]->name);
+        PopScene();
+    }
+
+    stack[depth++] = scene;
+    CallHook(scene->load);
+}
+
+void SceneStack_Prefetch(const Scene *scene) {
+    if (scene == prefetched) return;
+
+    // Sem próxima cena provável: a pré-carga antiga não fica residente
+    if (scene == NULL || FindScene(scene) >= 0) {
+        DropPrefetch(NULL);
+        return;
+    }
+
+    DropPrefetch(scene);
+    prefetched = scene;
+    CallHook(scene->prefetch);
+}
+
+void SceneStack_Clear(void) {
+    DropPrefetch(NULL);
+    while (depth > 0) PopScene();
+}
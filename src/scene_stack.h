@@ -0,0 +1,33 @@
+#ifndef SCENE_STACK_H
+#define SCENE_STACK_H
+
+#include "raylib.h"
+
+#define SCENE_STACK_DEPTH 8
+
+// --- STRUCTS ---
+
+// Ciclo de vida dos recursos de uma tela. Qualquer gancho pode ser NULL.
+typedef struct {
+    const char *name;
+    bool isTransient;           // ao seguir para outra cena é descartada, não suspensa
+    void (*load)(void);
+    void (*unload)(void);
+    void (*suspend)(void);      // outra cena por cima: solta o pesado, guarda o estado
+    void (*resume)(void);
+    void (*prefetch)(void);     // provável próxima cena: começa a carregar em segundo plano
+} Scene;
+
+// --- PROTÓTIPOS DE FUNÇÕES ---
+
+// Se a cena já está na pilha, desempilha até ela; senão empilha por cima
+// (suspendendo o topo, ou descartando se ele for transitório)
+void SceneStack_Goto(const Scene *scene);
+// NULL (ou cena já na pilha) descarta a pré-carga atual
+void SceneStack_Prefetch(const Scene *scene);
+const Scene *SceneStack_Top(void);
+
+// Descarrega todas as cenas, do topo para a base
+void SceneStack_Clear(void);
+
+#endif
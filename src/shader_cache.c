@@ -0,0 +1,210 @@
+#include "shader_cache.h"
+#include "rlgl.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+    #include <direct.h>
+    #define MakeCacheDir(path) _mkdir(path)
+    #define GLAPIENTRY __stdcall
+#else
+    #include <sys/stat.h>
+    #define MakeCacheDir(path) mkdir(path, 0755)
+    #define GLAPIENTRY
+#endif
+
+#define SHADER_CACHE_MAGIC 0x43534D4D       // "MMSC"
+#define SHADER_CACHE_VERSION 1
+
+#define GL_VENDOR 0x1F00
+#define GL_RENDERER 0x1F01
+#define GL_VERSION 0x1F02
+#define GL_LINK_STATUS 0x8B82
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+
+typedef const unsigned char *(GLAPIENTRY *GetStringProc)(unsigned int name);
+typedef void (GLAPIENTRY *GetIntegervProc)(unsigned int pname, int *data);
+typedef void (GLAPIENTRY *GetProgramivProc)(unsigned int program, unsigned int pname, int *params);
+typedef void (GLAPIENTRY *GetProgramBinaryProc)(unsigned int program, int bufSize, int *length, unsigned int *binaryFormat, void *binary);
+typedef void (GLAPIENTRY *ProgramBinaryProc)(unsigned int program, unsigned int binaryFormat, const void *binary, int length);
+typedef unsigned int (GLAPIENTRY *CreateProgramProc)(void);
+typedef void (GLAPIENTRY *DeleteProgramProc)(unsigned int program);
+
+// A raylib desktop já traz o GLFW; as funções de program binary (GL 4.1 /
+// ARB_get_program_binary) não são expostas pelo rlgl
+typedef void (*GLProc)(void);
+extern GLProc glfwGetProcAddress(const char *procname);
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t driverHash;
+    uint64_t sourceHash;
+    uint32_t binaryFormat;
+    uint32_t binaryLength;
+} ShaderCacheHeader;
+
+static struct {
+    GetProgramivProc getProgramiv;
+    GetProgramBinaryProc getProgramBinary;
+    ProgramBinaryProc programBinary;
+    CreateProgramProc createProgram;
+    DeleteProgramProc deleteProgram;
+} gl;
+
+static bool isInitialized = false;
+static bool isSupported = false;
+static uint64_t driverHash = 0;
+
+static uint64_t HashString(uint64_t hash, const char *text) {
+    if (text == NULL) return hash;
+    for (const unsigned char *c = (const unsigned char *)text; *c != '\0'; c++) {
+        hash ^= *c;
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+static void InitShaderCache(void) {
+    isInitialized = true;
+
+    GetStringProc getString = (GetStringProc)glfwGetProcAddress("glGetString");
+    GetIntegervProc getIntegerv = (GetIntegervProc)glfwGetProcAddress("glGetIntegerv");
+    gl.getProgramiv = (GetProgramivProc)glfwGetProcAddress("glGetProgramiv");
+    gl.getProgramBinary = (GetProgramBinaryProc)glfwGetProcAddress("glGetProgramBinary");
+    gl.programBinary = (ProgramBinaryProc)glfwGetProcAddress("glProgramBinary");
+    gl.createProgram = (CreateProgramProc)glfwGetProcAddress("glCreateProgram");
+    gl.deleteProgram = (DeleteProgramProc)glfwGetProcAddress("glDeleteProgram");
+
+    if (!getString || !getIntegerv || !gl.getProgramiv || !gl.getProgramBinary ||
+        !gl.programBinary || !gl.createProgram || !gl.deleteProgram) return;
+
+    // Sem nenhum formato binário o driver não consegue recarregar o programa
+    int formatCount = 0;
+    getIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    if (formatCount <= 0) {
+        printf("SHADERS: Driver sem suporte a program binary, compilando sempre\n");
+        return;
+    }
+
+    // Binário só serve para o mesmo driver (e o mesmo vertex shader padrão da raylib)
+    driverHash = 0xCBF29CE484222325ull;
+    driverHash = HashString(driverHash, (const char *)getString(GL_VENDOR));
+    driverHash = HashString(driverHash, (const char *)getString(GL_RENDERER));
+    driverHash = HashString(driverHash, (const char *)getString(GL_VERSION));
+    driverHash = HashString(driverHash, RAYLIB_VERSION);
+    isSupported = true;
+}
+
+static void GetCachePath(const char *name, char *out, int size) {
+    snprintf(out, size, "%s/%016llx.bin", SHADER_CACHE_DIR, (unsigned long long)HashString(0xCBF29CE484222325ull, name));
+}
+
+// Mesmas localizações que o LoadShaderFromMemory preenche
+static Shader MakeShader(unsigned int id) {
+    Shader shader = { 0 };
+    shader.id = id;
+    shader.locs = (int *)MemAlloc(RL_MAX_SHADER_LOCATIONS * sizeof(int));
+    for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
+
+    shader.locs[SHADER_LOC_VERTEX_POSITION] = rlGetLocationAttrib(id, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+    shader.locs[SHADER_LOC_VERTEX_TEXCOORD01] = rlGetLocationAttrib(id, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
+    shader.locs[SHADER_LOC_VERTEX_TEXCOORD02] = rlGetLocationAttrib(id, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+    shader.locs[SHADER_LOC_VERTEX_NORMAL] = rlGetLocationAttrib(id, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
+    shader.locs[SHADER_LOC_VERTEX_TANGENT] = rlGetLocationAttrib(id, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
+    shader.locs[SHADER_LOC_VERTEX_COLOR] = rlGetLocationAttrib(id, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+
+    shader.locs[SHADER_LOC_MATRIX_MVP] = rlGetLocationUniform(id, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
+    shader.locs[SHADER_LOC_MATRIX_VIEW] = rlGetLocationUniform(id, RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW);
+    shader.locs[SHADER_LOC_MATRIX_PROJECTION] = rlGetLocationUniform(id, RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION);
+    shader.locs[SHADER_LOC_MATRIX_MODEL] = rlGetLocationUniform(id, RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL);
+    shader.locs[SHADER_LOC_MATRIX_NORMAL] = rlGetLocationUniform(id, RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL);
+
+    shader.locs[SHADER_LOC_COLOR_DIFFUSE] = rlGetLocationUniform(id, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
+    shader.locs[SHADER_LOC_MAP_DIFFUSE] = rlGetLocationUniform(id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);
+    shader.locs[SHADER_LOC_MAP_SPECULAR] = rlGetLocationUniform(id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1);
+    shader.locs[SHADER_LOC_MAP_NORMAL] = rlGetLocationUniform(id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2);
+    return shader;
+}
+
+static bool LoadCachedProgram(const char *path, uint64_t sourceHash, Shader *out) {
+    int size = 0;
+    unsigned char *data = LoadFileData(path, &size);
+    if (data == NULL) return false;
+
+    const ShaderCacheHeader *header = (const ShaderCacheHeader *)data;
+    bool isValid = size >= (int)sizeof(ShaderCacheHeader) &&
+                   header->magic == SHADER_CACHE_MAGIC &&
+                   header->version == SHADER_CACHE_VERSION &&
+                   header->driverHash == driverHash &&
+                   header->sourceHash == sourceHash &&
+                   (int)header->binaryLength == size - (int)sizeof(ShaderCacheHeader);
+
+    unsigned int id = 0;
+    if (isValid) {
+        id = gl.createProgram();
+        gl.programBinary(id, header->binaryFormat, data + sizeof(ShaderCacheHeader), (int)header->binaryLength);
+
+        // O driver pode recusar o binário (atualização, outra GPU): recompila
+        int linked = 0;
+        gl.getProgramiv(id, GL_LINK_STATUS, &linked);
+        if (!linked) {
+            gl.deleteProgram(id);
+            id = 0;
+        }
+    }
+    UnloadFileData(data);
+
+    if (id == 0) return false;
+    *out = MakeShader(id);
+    return true;
+}
+
+static void SaveCachedProgram(const char *path, unsigned int id, uint64_t sourceHash) {
+    int length = 0;
+    gl.getProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+
+    int size = (int)sizeof(ShaderCacheHeader) + length;
+    unsigned char *data = (unsigned char *)MemAlloc(size);
+    ShaderCacheHeader *header = (ShaderCacheHeader *)data;
+
+    int written = 0;
+    unsigned int format = 0;
+    gl.getProgramBinary(id, length, &written, &format, data + sizeof(ShaderCacheHeader));
+
+    if (written > 0) {
+        *header = (ShaderCacheHeader){ SHADER_CACHE_MAGIC, SHADER_CACHE_VERSION, driverHash, sourceHash, format, (uint32_t)written };
+        MakeCacheDir(SHADER_CACHE_DIR);
+        if (!SaveFileData(path, data, (int)sizeof(ShaderCacheHeader) + written)) {
+            printf("SHADERS: Nao foi possivel gravar %s\n", path);
+        }
+    }
+    MemFree(data);
+}
+
+Shader ShaderCache_Load(const char *name, const char *fsCode) {
+    if (!isInitialized) InitShaderCache();
+    if (!isSupported || fsCode == NULL) return LoadShaderFromMemory(NULL, fsCode);
+
+    char path[256];
+    GetCachePath(name, path, sizeof(path));
+    uint64_t sourceHash = HashString(0xCBF29CE484222325ull, fsCode);
+
+    Shader shader = { 0 };
+    if (LoadCachedProgram(path, sourceHash, &shader)) {
+        printf("SHADERS: %s carregado do cache\n", name);
+        return shader;
+    }
+
+    shader = LoadShaderFromMemory(NULL, fsCode);
+
+    // Falha de compilação cai no shader padrão, que não vai para o cache
+    if (shader.id != 0 && shader.id != rlGetShaderIdDefault()) {
+        SaveCachedProgram(path, shader.id, sourceHash);
+    }
+    return shader;
+}
@@ -0,0 +1,15 @@
+#ifndef SHADER_CACHE_H
+#define SHADER_CACHE_H
+
+#include "raylib.h"
+
+#define SHADER_CACHE_DIR "shader_cache"
+
+// --- PROTÓTIPOS DE FUNÇÕES ---
+
+// Igual a LoadShaderFromMemory(NULL, fsCode), mas guarda o programa linkado
+// em disco (glGetProgramBinary). A entrada só vale para o mesmo driver e o
+// mesmo código; qualquer diferença recompila e regrava.
+Shader ShaderCache_Load(const char *name, const char *fsCode);
+
+#endif
@@ -0,0 +1,163 @@
+#include "sound_pool.h"
+#include "asset_loader.h"
+#include <stdio.h>
+
+typedef struct {
+    bool isLoaded;
+    Sound variants[SOUND_POOL_MAX_VARIANTS];   // donas das amostras; as vozes são aliases
+    int variantCount;
+    int maxInstances;
+    SoundPriority priority;
+    unsigned int lastTick;
+    bool hasPlayed;
+} PooledSound;
+
+typedef struct {
+    Sound alias;
+    bool hasAlias;
+    int sound;
+    int variant;
+    unsigned int startOrder;    // para achar a voz mais antiga
+} Voice;
+
+static PooledSound sounds[SOUND_POOL_MAX_SOUNDS];
+static Voice voices[SOUND_POOL_VOICES];
+static unsigned int currentTick = 0;
+static unsigned int playCount = 0;
+static float volume = 1.0f;
+
+static bool IsValidSound(int sound) {
+    return sound >= 0 && sound < SOUND_POOL_MAX_SOUNDS && sounds[sound].isLoaded;
+}
+
+static bool IsVoicePlaying(const Voice *voice) {
+    return voice->hasAlias && IsSoundPlaying(voice->alias);
+}
+
+static void ReleaseVoice(Voice *voice) {
+    if (!voice->hasAlias) return;
+    StopSound(voice->alias);
+    UnloadSoundAlias(voice->alias);
+    *voice = (Voice){ 0 };
+}
+
+// true se 'a' deve perder a voz antes de 'b'
+static bool IsWorseVictim(const Voice *a, const Voice *b) {
+    SoundPriority priorityA = sounds[a->sound].priority;
+    SoundPriority priorityB = sounds[b->sound].priority;
+    if (priorityA != priorityB) return priorityA < priorityB;
+    return a->startOrder < b->startOrder;
+}
+
+// Escolha entre vozes paradas: 2 = alias já é deste som e variação,
+// 1 = voz vazia, 0 = teria de descartar o alias de outro som/variação
+static int IdleMatch(const Voice *voice, int sound, int variant) {
+    if (!voice->hasAlias) return 1;
+    return (voice->sound == sound && voice->variant == variant) ? 2 : 0;
+}
+
+static Voice *FindVoice(int sound, int variant) {
+    Voice *oldestOwn = NULL;
+    Voice *idle = NULL;
+    Voice *victim = NULL;
+    int ownCount = 0;
+
+    for (int i = 0; i < SOUND_POOL_VOICES; i++) {
+        Voice *voice = &voices[i];
+        if (!IsVoicePlaying(voice)) {
+            // Prefere uma voz parada com o alias certo: evita recriá-lo
+            if (idle == NULL || IdleMatch(voice, sound, variant) > IdleMatch(idle, sound, variant)) idle = voice;
+            continue;
+        }
+
+        if (voice->sound == sound) {
+            ownCount++;
+            if (oldestOwn == NULL || voice->startOrder < oldestOwn->startOrder) oldestOwn = voice;
+        }
+        if (victim == NULL || IsWorseVictim(voice, victim)) victim = voice;
+    }
+
+    if (ownCount >= sounds[sound].maxInstances) return oldestOwn;
+    if (idle != NULL) return idle;
+    if (sounds[victim->sound].priority <= sounds[sound].priority) return victim;
+    return NULL;
+}
+
+int SoundPool_Load(const char *fileName, int maxInstances, SoundPriority priority) {
+    for (int i = 0; i < SOUND_POOL_MAX_SOUNDS; i++) {
+        if (sounds[i].isLoaded) continue;
+
+        Sound source = Assets_LoadSound(fileName);
+        if (source.frameCount == 0) return SOUND_NONE;
+
+        sounds[i] = (PooledSound){ 0 };
+        sounds[i].isLoaded = true;
+        sounds[i].variants[0] = source;
+        sounds[i].variantCount = 1;
+        sounds[i].maxInstances = (maxInstances > 0) ? maxInstances : 1;
+        sounds[i].priority = priority;
+        return i;
+    }
+
+    printf("ERRO: Limite de sons atingido, %s ignorado\n", fileName);
+    return SOUND_NONE;
+}
+
+void SoundPool_AddVariant(int sound, const char *fileName) {
+    if (!IsValidSound(sound)) return;
+
+    PooledSound *pooled = &sounds[sound];
+    if (pooled->variantCount >= SOUND_POOL_MAX_VARIANTS) {
+        printf("ERRO: Limite de variacoes atingido, %s ignorado\n", fileName);
+        return;
+    }
+
+    Sound source = Assets_LoadSound(fileName);
+    if (source.frameCount > 0) pooled->variants[pooled->variantCount++] = source;
+}
+
+void SoundPool_Unload(int sound) {
+    if (!IsValidSound(sound)) return;
+
+    // Aliases antes das amostras que eles usam
+    for (int i = 0; i < SOUND_POOL_VOICES; i++) {
+        if (voices[i].hasAlias && voices[i].sound == sound) ReleaseVoice(&voices[i]);
+    }
+    for (int i = 0; i < sounds[sound].variantCount; i++) {
+        UnloadSound(sounds[sound].variants[i]);
+    }
+    sounds[sound] = (PooledSound){ 0 };
+}
+
+void SoundPool_BeginTick(void) {
+    currentTick++;
+}
+
+void SoundPool_Play(int sound) {
+    if (!IsValidSound(sound)) return;
+
+    PooledSound *pooled = &sounds[sound];
+    if (pooled->hasPlayed && pooled->lastTick == currentTick) return;
+    pooled->hasPlayed = true;
+    pooled->lastTick = currentTick;
+
+    int variant = (pooled->variantCount > 1) ? GetRandomValue(0, pooled->variantCount - 1) : 0;
+    Voice *voice = FindVoice(sound, variant);
+    if (voice == NULL) return;
+
+    if (!voice->hasAlias || voice->sound != sound || voice->variant != variant) {
+        ReleaseVoice(voice);
+        voice->alias = LoadSoundAlias(pooled->variants[variant]);
+        voice->hasAlias = true;
+        voice->sound = sound;
+        voice->variant = variant;
+    }
+
+    voice->startOrder = playCount++;
+    SetSoundVolume(voice->alias, volume);
+    PlaySound(voice->alias);
+}
+
+void SoundPool_SetVolume(float newVolume) {
+    volume = newVolume;
+}
@@ -0,0 +1,35 @@
+#ifndef SOUND_POOL_H
+#define SOUND_POOL_H
+
+#include "raylib.h"
+
+#define SOUND_POOL_MAX_SOUNDS 16
+#define SOUND_POOL_MAX_VARIANTS 4
+#define SOUND_POOL_VOICES 12        // teto de efeitos tocando ao mesmo tempo no mixer
+#define SOUND_NONE -1
+
+// --- ENUMS ---
+
+// Com o pool cheio, um som só rouba a voz de outro de prioridade igual ou menor
+typedef enum {
+    SOUND_PRIORITY_LOW,
+    SOUND_PRIORITY_NORMAL,
+    SOUND_PRIORITY_HIGH
+} SoundPriority;
+
+// --- PROTÓTIPOS DE FUNÇÕES ---
+
+// Retorna o id do som, ou SOUND_NONE. maxInstances limita quantas cópias dele
+// tocam juntas; a mais antiga é reiniciada quando passa do limite.
+int SoundPool_Load(const char *fileName, int maxInstances, SoundPriority priority);
+
+// Outra gravação do mesmo som; cada disparo sorteia uma
+void SoundPool_AddVariant(int sound, const char *fileName);
+void SoundPool_Unload(int sound);
+
+// Disparos repetidos do mesmo som no mesmo tick viram um só
+void SoundPool_BeginTick(void);
+void SoundPool_Play(int sound);
+void SoundPool_SetVolume(float volume);
+
+#endif
@@ -0,0 +1,269 @@
+#include "sprite_atlas.h"
+#include "asset_loader.h"
+#include "cJSON.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct {
+    float hueShift;
+    Color tint;
+    Color fallbackTint;         // sem paleta indexada: aproxima a variante
+} PaletteVariantDef;
+
+static const PaletteVariantDef paletteVariants[PALETTE_VARIANT_COUNT] = {
+    [PALETTE_ORIGINAL]  = { 0.0f,   { 255, 255, 255, 255 }, { 255, 255, 255, 255 } },
+    [PALETTE_COOL_TINT] = { 0.0f,   { 200, 200, 255, 255 }, { 200, 200, 255, 255 } },
+    [PALETTE_HUE_120]   = { 120.0f, { 255, 255, 255, 255 }, { 200, 255, 200, 255 } },
+    [PALETTE_HUE_240]   = { 240.0f, { 255, 255, 255, 255 }, { 200, 200, 255, 255 } },
+};
+
+static Shader paletteShader = { 0 };
+static int paletteLoc = -1;
+static int paletteRowLoc = -1;
+static bool isPaletteShaderReady = false;
+
+static bool SameColor(Color a, Color b) {
+    return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+}
+
+static Color MultiplyColor(Color a, Color b) {
+    return (Color){
+        (unsigned char)(a.r * b.r / 255), (unsigned char)(a.g * b.g / 255),
+        (unsigned char)(a.b * b.b / 255), (unsigned char)(a.a * b.a / 255)
+    };
+}
+
+static Color ApplyVariant(Color color, const PaletteVariantDef *variant) {
+    if (variant->hueShift != 0.0f) {
+        Vector3 hsv = ColorToHSV(color);
+        unsigned char alpha = color.a;
+        color = ColorFromHSV(fmodf(hsv.x + variant->hueShift, 360.0f), hsv.y, hsv.z);
+        color.a = alpha;
+    }
+    return MultiplyColor(color, variant->tint);
+}
+
+// Troca cada pixel pelo índice da sua cor e gera a textura de paleta
+// (uma linha por variante). Se houver cores demais a imagem fica intacta.
+static bool BuildIndexedImage(SpriteAtlas *atlas, Image *image) {
+    Color colors[PALETTE_MAX_COLORS];
+    int colorCount = 1;
+    colors[0] = BLANK;
+
+    Color *pixels = (Color *)image->data;
+    int pixelCount = image->width * image->height;
+    unsigned char *indices = (unsigned char *)malloc(pixelCount);
+    int last = 0;
+
+    for (int i = 0; i < pixelCount; i++) {
+        Color c = pixels[i];
+        if (c.a == 0) {
+            indices[i] = 0;
+            continue;
+        }
+
+        if (!SameColor(colors[last], c)) {
+            last = -1;
+            for (int k = 1; k < colorCount; k++) {
+                if (SameColor(colors[k], c)) { last = k; break; }
+            }
+            if (last < 0) {
+                if (colorCount >= PALETTE_MAX_COLORS) {
+                    free(indices);
+                    return false;
+                }
+                last = colorCount;
+                colors[colorCount++] = c;
+            }
+        }
+        indices[i] = (unsigned char)last;
+    }
+
+    for (int i = 0; i < pixelCount; i++) {
+        pixels[i] = (Color){ indices[i], 0, 0, (indices[i] != 0) ? 255 : 0 };
+    }
+    free(indices);
+
+    Image paletteImage = GenImageColor(PALETTE_MAX_COLORS, PALETTE_VARIANT_COUNT, BLANK);
+    Color *paletteRows = (Color *)paletteImage.data;
+    for (int v = 0; v < PALETTE_VARIANT_COUNT; v++) {
+        for (int k = 1; k < colorCount; k++) {
+            paletteRows[v * PALETTE_MAX_COLORS + k] = ApplyVariant(colors[k], &paletteVariants[v]);
+        }
+    }
+
+    atlas->palette = LoadTextureFromImage(paletteImage);
+    SetTextureFilter(atlas->palette, TEXTURE_FILTER_POINT);
+    UnloadImage(paletteImage);
+    return true;
+}
+
+// Só indexa se o shader de paleta carregou; sem ele a textura fica RGBA
+static bool LoadAtlasTexture(SpriteAtlas *atlas, const char *path) {
+    Image image = Assets_LoadImage(path);
+    if (image.data == NULL) return false;
+
+    ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    if (isPaletteShaderReady) atlas->isIndexed = BuildIndexedImage(atlas, &image);
+
+    atlas->texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+    return atlas->texture.id != 0;
+}
+
+static int GetInt(cJSON *json, const char *key) {
+    cJSON *item = cJSON_GetObjectItem(json, key);
+    return cJSON_IsNumber(item) ? item->valueint : 0;
+}
+
+static bool LoadPackedAtlas(SpriteAtlas *atlas, const char *atlasPath) {
+    char *data = Assets_LoadText(atlasPath);
+    if (data == NULL) return false;
+
+    cJSON *root = cJSON_Parse(data);
+    Assets_UnloadText(data);
+    if (!root) {
+        printf("ERRO: JSON invalido em %s\n", atlasPath);
+        return false;
+    }
+
+    cJSON *texture = cJSON_GetObjectItem(root, "texture");
+    cJSON *frames = cJSON_GetObjectItem(root, "frames");
+    int frameCount = cJSON_GetArraySize(frames);
+
+    if (!cJSON_IsString(texture) || frameCount <= 0) {
+        printf("ERRO: Atlas incompleto em %s\n", atlasPath);
+        cJSON_Delete(root);
+        return false;
+    }
+
+    if (!LoadAtlasTexture(atlas, texture->valuestring)) {
+        cJSON_Delete(root);
+        return false;
+    }
+
+    atlas->frameWidth = GetInt(root, "frame_width");
+    atlas->frameHeight = GetInt(root, "frame_height");
+    atlas->frameCount = frameCount;
+    atlas->frames = (SpriteFrame *)malloc(frameCount * sizeof(SpriteFrame));
+
+    int i = 0;
+    cJSON *frame = NULL;
+    cJSON_ArrayForEach(frame, frames) {
+        atlas->frames[i].source = (Rectangle){
+            (float)GetInt(frame, "x"), (float)GetInt(frame, "y"),
+            (float)GetInt(frame, "w"), (float)GetInt(frame, "h")
+        };
+        atlas->frames[i].offset = (Vector2){ (float)GetInt(frame, "ox"), (float)GetInt(frame, "oy") };
+        i++;
+    }
+
+    cJSON_Delete(root);
+    return true;
+}
+
+static bool LoadGridAtlas(SpriteAtlas *atlas, const char *sheetPath, int frameWidth, int frameHeight) {
+    if (!LoadAtlasTexture(atlas, sheetPath) || frameWidth <= 0 || frameHeight <= 0) return false;
+
+    int columns = atlas->texture.width / frameWidth;
+    int rows = (atlas->texture.height + frameHeight - 1) / frameHeight;
+
+    atlas->frameWidth = frameWidth;
+    atlas->frameHeight = frameHeight;
+    atlas->frameCount = columns * rows;
+    atlas->frames = (SpriteFrame *)malloc(atlas->frameCount * sizeof(SpriteFrame));
+
+    for (int i = 0; i < atlas->frameCount; i++) {
+        atlas->frames[i].source = (Rectangle){
+            (float)((i % columns) * frameWidth), (float)((i / columns) * frameHeight),
+            (float)frameWidth, (float)frameHeight
+        };
+        atlas->frames[i].offset = (Vector2){ 0.0f, 0.0f };
+    }
+    return true;
+}
+
+bool SpriteAtlas_Load(SpriteAtlas *atlas, const char *atlasPath, const char *sheetPath, int frameWidth, int frameHeight) {
+    *atlas = (SpriteAtlas){ 0 };
+
+    bool loaded = false;
+    if (atlasPath != NULL && Assets_Exists(atlasPath)) loaded = LoadPackedAtlas(atlas, atlasPath);
+
+    if (!loaded) {
+        SpriteAtlas_Unload(atlas);
+        loaded = LoadGridAtlas(atlas, sheetPath, frameWidth, frameHeight);
+    }
+
+    if (!loaded) {
+        printf("ERRO: Nao foi possivel carregar sprites de %s\n", sheetPath);
+        SpriteAtlas_Unload(atlas);
+        return false;
+    }
+
+    SetTextureFilter(atlas->texture, TEXTURE_FILTER_POINT);
+    return true;
+}
+
+void SpriteAtlas_Unload(SpriteAtlas *atlas) {
+    if (atlas->texture.id != 0) UnloadTexture(atlas->texture);
+    if (atlas->palette.id != 0) UnloadTexture(atlas->palette);
+    free(atlas->frames);
+    *atlas = (SpriteAtlas){ 0 };
+}
+
+// Precisa vir antes de SpriteAtlas_Load para os atlas saírem indexados
+void SpriteAtlas_LoadPaletteShader(void) {
+    if (isPaletteShaderReady) return;
+
+    paletteShader = Assets_LoadShader("assets/shaders/palette_swap.fs");
+    paletteLoc = GetShaderLocation(paletteShader, "palette");
+    paletteRowLoc = GetShaderLocation(paletteShader, "paletteRow");
+
+    // Shader que não compilou vira o padrão do raylib, sem esses uniforms
+    isPaletteShaderReady = (paletteLoc >= 0 && paletteRowLoc >= 0);
+    if (!isPaletteShaderReady) {
+        printf("SPRITES: Shader de paleta indisponivel, usando texturas RGBA\n");
+        UnloadShader(paletteShader);
+    }
+}
+
+void SpriteAtlas_UnloadPaletteShader(void) {
+    if (isPaletteShaderReady) UnloadShader(paletteShader);
+    isPaletteShaderReady = false;
+}
+
+void SpriteAtlas_DrawFrame(const SpriteAtlas *atlas, int frame, Rectangle dest, Vector2 origin, float rotation, bool flipX, PaletteVariant variant, Color tint) {
+    if (atlas->texture.id == 0 || frame < 0 || frame >= atlas->frameCount) return;
+
+    const SpriteFrame *f = &atlas->frames[frame];
+    if (f->source.width <= 0.0f) return;
+
+    float scaleX = dest.width / atlas->frameWidth;
+    float scaleY = dest.height / atlas->frameHeight;
+
+    // Espelhado, o recorte vai para o outro lado do quadro; o pivô fica onde estava
+    float localX = flipX ? (atlas->frameWidth - f->offset.x - f->source.width) : f->offset.x;
+
+    Rectangle source = f->source;
+    if (flipX) source.width = -source.width;
+
+    Rectangle trimmedDest = { dest.x, dest.y, f->source.width * scaleX, f->source.height * scaleY };
+    Vector2 trimmedOrigin = { origin.x - localX * scaleX, origin.y - f->offset.y * scaleY };
+
+    if (variant < 0 || variant >= PALETTE_VARIANT_COUNT) variant = PALETTE_ORIGINAL;
+
+    if (!atlas->isIndexed) {
+        // Sem paleta só dá para aproximar a variante pelo tint
+        DrawTexturePro(atlas->texture, source, trimmedDest, trimmedOrigin, rotation, MultiplyColor(tint, paletteVariants[variant].fallbackTint));
+        return;
+    }
+
+    float paletteRow = (variant + 0.5f) / PALETTE_VARIANT_COUNT;
+
+    BeginShaderMode(paletteShader);
+        SetShaderValue(paletteShader, paletteRowLoc, &paletteRow, SHADER_UNIFORM_FLOAT);
+        SetShaderValueTexture(paletteShader, paletteLoc, atlas->palette);
+        DrawTexturePro(atlas->texture, source, trimmedDest, trimmedOrigin, rotation, tint);
+    EndShaderMode();
+}
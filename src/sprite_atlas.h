@@ -0,0 +1,52 @@
+#ifndef SPRITE_ATLAS_H
+#define SPRITE_ATLAS_H
+
+#include "raylib.h"
+
+#define PALETTE_MAX_COLORS 256
+
+// --- ENUMS ---
+
+// Linhas da textura de paleta de cada atlas indexado
+typedef enum {
+    PALETTE_ORIGINAL,
+    PALETTE_COOL_TINT,
+    PALETTE_HUE_120,
+    PALETTE_HUE_240,
+    PALETTE_VARIANT_COUNT
+} PaletteVariant;
+
+// --- STRUCTS ---
+
+typedef struct {
+    Rectangle source;       // região no atlas (largura 0 = quadro vazio)
+    Vector2 offset;         // canto do recorte dentro do quadro original
+} SpriteFrame;
+
+// Folha de quadros recortados gerada pelo tools/spritepack. Os quadros
+// continuam endereçados pelo índice da grade original.
+typedef struct {
+    Texture2D texture;
+    int frameWidth;
+    int frameHeight;
+    int frameCount;
+    SpriteFrame *frames;
+
+    // Com paleta, texture guarda só índices (R) e cobertura (A)
+    bool isIndexed;
+    Texture2D palette;
+} SpriteAtlas;
+
+// --- PROTÓTIPOS DE FUNÇÕES ---
+
+// Usa o atlas empacotado se existir; senão fatia a folha em grade sem recorte
+bool SpriteAtlas_Load(SpriteAtlas *atlas, const char *atlasPath, const char *sheetPath, int frameWidth, int frameHeight);
+void SpriteAtlas_Unload(SpriteAtlas *atlas);
+
+void SpriteAtlas_LoadPaletteShader(void);
+void SpriteAtlas_UnloadPaletteShader(void);
+
+// dest/origin descrevem o quadro inteiro, como num DrawTexturePro da folha original
+void SpriteAtlas_DrawFrame(const SpriteAtlas *atlas, int frame, Rectangle dest, Vector2 origin, float rotation, bool flipX, PaletteVariant variant, Color tint);
+
+#endif
@@ -0,0 +1,241 @@
+#include "texture_stream.h"
+#include "asset_loader.h"
+#include <limits.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+typedef enum {
+    REQUEST_QUEUED,
+    REQUEST_DECODING,
+    REQUEST_DECODED,
+    REQUEST_DONE            // entregue ou cancelado; o slot pode ser reaproveitado
+} RequestState;
+
+typedef struct {
+    char fileName[256];
+    Texture2D *target;
+    int priority;
+    int filter;
+    int wrap;
+    Image image;
+    RequestState state;
+    bool isCancelled;
+} TextureRequest;
+
+static TextureRequest requests[TEXTURE_STREAM_MAX_REQUESTS];
+static int requestCount = 0;
+
+static pthread_t workers[TEXTURE_STREAM_MAX_WORKERS];
+static int workerCount = 0;
+static bool isShuttingDown = false;
+
+static pthread_mutex_t streamLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t workReady = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t decodeDone = PTHREAD_COND_INITIALIZER;
+
+static void ApplySampling(Texture2D texture, int filter, int wrap) {
+    if (filter != TEXTURE_STREAM_KEEP) SetTextureFilter(texture, filter);
+    if (wrap != TEXTURE_STREAM_KEEP) SetTextureWrap(texture, wrap);
+}
+
+// Chamar com o lock. Empate de prioridade fica com o pedido mais antigo.
+static TextureRequest *FindRequest(RequestState state, int maxPriority) {
+    TextureRequest *best = NULL;
+    for (int i = 0; i < requestCount; i++) {
+        TextureRequest *request = &requests[i];
+        if (request->state != state || request->priority > maxPriority) continue;
+        if (best == NULL || request->priority < best->priority) best = request;
+    }
+    return best;
+}
+
+// Chamar com o lock; ele é solto enquanto a imagem decodifica
+static void DecodeRequest(TextureRequest *request) {
+    request->state = REQUEST_DECODING;
+    pthread_mutex_unlock(&streamLock);
+
+    Image image = Assets_DecodeTexture(request->fileName);
+
+    pthread_mutex_lock(&streamLock);
+    if (request->isCancelled) {
+        UnloadImage(image);
+        request->state = REQUEST_DONE;
+    } else {
+        request->image = image;
+        request->state = REQUEST_DECODED;
+    }
+    pthread_cond_broadcast(&decodeDone);
+}
+
+// Só na thread principal (contexto OpenGL), com o lock
+static void UploadRequest(TextureRequest *request) {
+    Image image = request->image;
+    request->image = (Image){ 0 };
+    request->state = REQUEST_DONE;
+    pthread_mutex_unlock(&streamLock);
+
+    Texture2D texture = Assets_UploadTexture(request->fileName, image);
+    ApplySampling(texture, request->filter, request->wrap);
+    *request->target = texture;
+
+    pthread_mutex_lock(&streamLock);
+}
+
+// Chamar com o lock. Slots em decodificação nunca são reaproveitados, porque
+// a thread que decodifica guarda o ponteiro sem o lock.
+static TextureRequest *AllocRequest(void) {
+    for (int i = 0; i < requestCount; i++) {
+        if (requests[i].state == REQUEST_DONE) return &requests[i];
+    }
+    if (requestCount >= TEXTURE_STREAM_MAX_REQUESTS) return NULL;
+    return &requests[requestCount++];
+}
+
+static void *WorkerMain(void *arg) {
+    (void)arg;
+
+    pthread_mutex_lock(&streamLock);
+    while (!isShuttingDown) {
+        TextureRequest *request = FindRequest(REQUEST_QUEUED, INT_MAX);
+        if (request == NULL) {
+            pthread_cond_wait(&workReady, &streamLock);
+            continue;
+        }
+        DecodeRequest(request);
+    }
+    pthread_mutex_unlock(&streamLock);
+    return NULL;
+}
+
+void TextureStream_Init(int count) {
+    if (count > TEXTURE_STREAM_MAX_WORKERS) count = TEXTURE_STREAM_MAX_WORKERS;
+
+    isShuttingDown = false;
+    workerCount = 0;
+    for (int i = 0; i < count; i++) {
+        if (pthread_create(&workers[workerCount], NULL, WorkerMain, NULL) != 0) break;
+        workerCount++;
+    }
+
+    // Sem threads tudo ainda carrega, só que dentro do TextureStream_Finish
+    if (workerCount < count) {
+        printf("TEXTURAS: Apenas %d de %d threads de decodificacao criadas\n", workerCount, count);
+    }
+}
+
+void TextureStream_Shutdown(void) {
+    pthread_mutex_lock(&streamLock);
+    isShuttingDown = true;
+    pthread_cond_broadcast(&workReady);
+    pthread_mutex_unlock(&streamLock);
+
+    for (int i = 0; i < workerCount; i++) pthread_join(workers[i], NULL);
+    workerCount = 0;
+
+    for (int i = 0; i < requestCount; i++) {
+        if (requests[i].state == REQUEST_DECODED) UnloadImage(requests[i].image);
+    }
+    requestCount = 0;
+}
+
+void TextureStream_Request(Texture2D *target, const char *fileName, int priority, int filter, int wrap) {
+    *target = (Texture2D){ 0 };
+
+    pthread_mutex_lock(&streamLock);
+    TextureRequest *request = AllocRequest();
+    if (request == NULL) {
+        pthread_mutex_unlock(&streamLock);
+
+        printf("TEXTURAS: Fila cheia, carregando %s na hora\n", fileName);
+        *target = Assets_LoadTexture(fileName);
+        ApplySampling(*target, filter, wrap);
+        return;
+    }
+
+    strncpy(request->fileName, fileName, sizeof(request->fileName) - 1);
+    request->fileName[sizeof(request->fileName) - 1] = '\0';
+    request->target = target;
+    request->priority = priority;
+    request->filter = filter;
+    request->wrap = wrap;
+    request->image = (Image){ 0 };
+    request->state = REQUEST_QUEUED;
+    request->isCancelled = false;
+
+    pthread_cond_signal(&workReady);
+    pthread_mutex_unlock(&streamLock);
+}
+
+void TextureStream_Update(double budget) {
+    double start = GetTime();
+
+    pthread_mutex_lock(&streamLock);
+    TextureRequest *request = NULL;
+    while ((request = FindRequest(REQUEST_DECODED, INT_MAX)) != NULL) {
+        UploadRequest(request);
+        if (GetTime() - start >= budget) break;
+    }
+    pthread_mutex_unlock(&streamLock);
+}
+
+void TextureStream_Finish(int priority) {
+    double start = GetTime();
+    bool hasWaited = false;
+
+    pthread_mutex_lock(&streamLock);
+    for (;;) {
+        TextureRequest *request = FindRequest(REQUEST_DECODED, priority);
+        if (request != NULL) {
+            UploadRequest(request);
+            continue;
+        }
+
+        request = FindRequest(REQUEST_QUEUED, priority);
+        if (request != NULL) {
+            hasWaited = true;
+            DecodeRequest(request);
+            continue;
+        }
+
+        if (FindRequest(REQUEST_DECODING, priority) == NULL) break;
+
+        hasWaited = true;
+        pthread_cond_wait(&decodeDone, &streamLock);
+    }
+    pthread_mutex_unlock(&streamLock);
+
+    if (hasWaited) {
+        printf("TEXTURAS: Espera de %.1f ms pela prioridade %d\n", (GetTime() - start) * 1000.0, priority);
+    }
+}
+
+// Chamar com o lock
+static TextureRequest *FindTarget(const Texture2D *target) {
+    for (int i = 0; i < requestCount; i++) {
+        TextureRequest *request = &requests[i];
+        if (request->target == target && request->state != REQUEST_DONE && !request->isCancelled) return request;
+    }
+    return NULL;
+}
+
+bool TextureStream_IsPending(const Texture2D *target) {
+    pthread_mutex_lock(&streamLock);
+    bool isPending = FindTarget(target) != NULL;
+    pthread_mutex_unlock(&streamLock);
+    return isPending;
+}
+
+void TextureStream_Cancel(const Texture2D *target) {
+    pthread_mutex_lock(&streamLock);
+    TextureRequest *request = FindTarget(target);
+    if (request != NULL) {
+        if (request->state == REQUEST_DECODED) UnloadImage(request->image);
+        request->image = (Image){ 0 };
+
+        // Em decodificação: a thread de trabalho descarta a imagem quando terminar
+        if (request->state == REQUEST_DECODING) request->isCancelled = true;
+        else request->state = REQUEST_DONE;
+    }
+    pthread_mutex_unlock(&streamLock);
+}
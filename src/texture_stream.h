@@ -0,0 +1,36 @@
+#ifndef TEXTURE_STREAM_H
+#define TEXTURE_STREAM_H
+
+#include "raylib.h"
+
+#define TEXTURE_STREAM_MAX_REQUESTS 64
+#define TEXTURE_STREAM_MAX_WORKERS 8
+
+// Filtro/wrap de textura que não deve ser alterado após o upload
+#define TEXTURE_STREAM_KEEP -1
+
+// --- PROTÓTIPOS DE FUNÇÕES ---
+
+// As imagens são decodificadas em threads de trabalho e enviadas para a GPU
+// na thread principal, da menor prioridade para a maior. Até o upload o
+// destino continua com id 0 (DrawTexture* ignora).
+void TextureStream_Init(int workerCount);
+void TextureStream_Shutdown(void);
+
+// target precisa continuar válido até o upload
+void TextureStream_Request(Texture2D *target, const char *fileName, int priority, int filter, int wrap);
+
+// Sobe texturas já decodificadas até estourar o orçamento (em segundos);
+// pelo menos uma por chamada, para nunca travar o carregamento
+void TextureStream_Update(double budget);
+
+// Bloqueia até todas as texturas com prioridade <= priority estarem na GPU.
+// Enquanto espera, a thread principal também decodifica.
+void TextureStream_Finish(int priority);
+
+bool TextureStream_IsPending(const Texture2D *target);
+
+// Desiste do pedido: o destino não é mais escrito
+void TextureStream_Cancel(const Texture2D *target);
+
+#endif
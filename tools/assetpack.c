@@ -0,0 +1,157 @@
+// Empacotador dos assets em um único arquivo (assets.pak).
+//
+// Percorre a pasta de assets do build (já com .dds e atlas gerados), guarda
+// cada arquivo uma vez (conteúdo repetido é deduplicado) e grava o índice
+// ordenado por hash do caminho. Formato descrito em src/asset_pack.h.
+//
+// Uso: assetpack <pastaAssets> <prefixo> <saida.pak>
+
+#include "raylib.h"
+#include "asset_pack.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    char path[256];
+    unsigned char *data;
+    int size;
+    PackEntry entry;
+    int duplicateOf;
+} PackItem;
+
+static uint32_t HashContent(const unsigned char *data, int size) {
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static int CompareByHash(const void *a, const void *b) {
+    const PackItem *ia = (const PackItem *)a;
+    const PackItem *ib = (const PackItem *)b;
+    if (ia->entry.pathHash != ib->entry.pathHash) return (ia->entry.pathHash < ib->entry.pathHash) ? -1 : 1;
+    return strcmp(ia->path, ib->path);
+}
+
+static bool IsExcluded(const char *path) {
+    return IsFileExtension(path, ".pak") || IsFileExtension(path, ".stamp");
+}
+
+static void WritePadding(FILE *f) {
+    static const unsigned char zeros[ASSET_PACK_ALIGNMENT] = { 0 };
+    long position = ftell(f);
+    long padding = (ASSET_PACK_ALIGNMENT - position % ASSET_PACK_ALIGNMENT) % ASSET_PACK_ALIGNMENT;
+    fwrite(zeros, 1, padding, f);
+}
+
+int main(int argc, char **argv) {
+    if (argc != 4) {
+        printf("Uso: %s <pastaAssets> <prefixo> <saida.pak>\n", argv[0]);
+        return 1;
+    }
+
+    const char *assetDir = argv[1];
+    const char *prefix = argv[2];
+    const char *outPath = argv[3];
+    int dirLength = (int)strlen(assetDir);
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    FilePathList files = LoadDirectoryFilesEx(assetDir, NULL, true);
+    PackItem *items = (PackItem *)calloc(files.count, sizeof(PackItem));
+    int itemCount = 0;
+
+    for (unsigned int i = 0; i < files.count; i++) {
+        const char *fullPath = files.paths[i];
+        if (IsExcluded(fullPath)) continue;
+
+        PackItem *item = &items[itemCount];
+        const char *relative = fullPath + dirLength;
+        while (*relative == '/' || *relative == '\\') relative++;
+
+        snprintf(item->path, sizeof(item->path), "%s/%s", prefix, relative);
+        for (char *c = item->path; *c != '\0'; c++) {
+            if (*c == '\\') *c = '/';
+        }
+
+        item->data = LoadFileData(fullPath, &item->size);
+        if (item->data == NULL) {
+            printf("ERRO: Nao foi possivel abrir %s\n", fullPath);
+            continue;
+        }
+
+        item->entry.pathHash = AssetPack_HashPath(item->path);
+        item->entry.size = (uint64_t)item->size;
+        item->entry.contentHash = HashContent(item->data, item->size);
+        item->duplicateOf = -1;
+        itemCount++;
+    }
+    UnloadDirectoryFiles(files);
+
+    qsort(items, itemCount, sizeof(PackItem), CompareByHash);
+
+    FILE *f = fopen(outPath, "wb");
+    if (!f) {
+        printf("ERRO: Nao foi possivel gravar %s\n", outPath);
+        return 1;
+    }
+
+    PackHeader header = { ASSET_PACK_MAGIC, ASSET_PACK_VERSION, (uint32_t)itemCount, 0, 0, 0 };
+    fwrite(&header, sizeof(header), 1, f);
+
+    long storedBytes = 0;
+    int duplicates = 0;
+
+    for (int i = 0; i < itemCount; i++) {
+        PackItem *item = &items[i];
+
+        for (int k = 0; k < i; k++) {
+            const PackItem *other = &items[k];
+            if (other->duplicateOf < 0 && other->size == item->size &&
+                other->entry.contentHash == item->entry.contentHash &&
+                memcmp(other->data, item->data, item->size) == 0) {
+                item->duplicateOf = k;
+                break;
+            }
+        }
+
+        if (item->duplicateOf >= 0) {
+            item->entry.offset = items[item->duplicateOf].entry.offset;
+            duplicates++;
+            continue;
+        }
+
+        WritePadding(f);
+        item->entry.offset = (uint64_t)ftell(f);
+        fwrite(item->data, 1, item->size, f);
+        storedBytes += item->size;
+    }
+
+    WritePadding(f);
+    header.indexOffset = (uint64_t)ftell(f);
+
+    uint32_t pathOffset = 0;
+    for (int i = 0; i < itemCount; i++) {
+        items[i].entry.pathOffset = pathOffset;
+        pathOffset += (uint32_t)strlen(items[i].path) + 1;
+        fwrite(&items[i].entry, sizeof(PackEntry), 1, f);
+    }
+
+    header.stringsOffset = (uint64_t)ftell(f);
+    for (int i = 0; i < itemCount; i++) {
+        fwrite(items[i].path, 1, strlen(items[i].path) + 1, f);
+    }
+
+    fseek(f, 0, SEEK_SET);
+    fwrite(&header, sizeof(header), 1, f);
+    fclose(f);
+
+    printf("ASSETPACK: %s (%d arquivos, %d repetidos, %ld KB)\n", outPath, itemCount, duplicates, storedBytes / 1024);
+
+    for (int i = 0; i < itemCount; i++) UnloadFileData(items[i].data);
+    free(items);
+    return 0;
+}
@@ -0,0 +1,193 @@
+// Gera tabelas const em C a partir dos movesets JSON dos personagens.
+//
+// Usa o próprio moveset_loader do jogo, então a timeline compilada é
+// idêntica à do carregamento em tempo de execução. O arquivo gerado define
+// EmbeddedMoveset_Find, consultado pelo registro de personagens quando o
+// jogo é compilado com MM_EMBED_MOVESETS.
+//
+// Uso: movesetgen <saida.c> <moveset.json>...
+// Os caminhos dos JSON viram a chave de busca: passe-os como o jogo os
+// referencia (ex.: assets/data/amoeba.json, a partir da raiz do projeto).
+
+#include "raylib.h"
+#include "game_scene.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// O loader lê pelo asset_loader; aqui não há pacote, só arquivos soltos
+char *Assets_LoadText(const char *fileName) {
+    return LoadFileText(fileName);
+}
+
+void Assets_UnloadText(char *text) {
+    UnloadFileText(text);
+}
+
+static void WriteFloat(FILE *f, float value) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.9g", value);
+    if (strpbrk(buffer, ".eE") == NULL) strcat(buffer, ".0");
+    fprintf(f, "%sf", buffer);
+}
+
+static void WriteVector2(FILE *f, Vector2 v) {
+    fprintf(f, "{ ");
+    WriteFloat(f, v.x);
+    fprintf(f, ", ");
+    WriteFloat(f, v.y);
+    fprintf(f, " }");
+}
+
+static void WriteRectangle(FILE *f, Rectangle r) {
+    fprintf(f, "{ ");
+    WriteFloat(f, r.x);
+    fprintf(f, ", ");
+    WriteFloat(f, r.y);
+    fprintf(f, ", ");
+    WriteFloat(f, r.width);
+    fprintf(f, ", ");
+    WriteFloat(f, r.height);
+    fprintf(f, " }");
+}
+
+static void WriteString(FILE *f, const char *text) {
+    fputc('"', f);
+    for (const unsigned char *c = (const unsigned char *)text; *c != '\0'; c++) {
+        if (*c == '"' || *c == '\\') fprintf(f, "\\%c", *c);
+        else if (*c < 0x20 || *c >= 0x7F) fprintf(f, "\\%03o", *c);
+        else fputc(*c, f);
+    }
+    fputc('"', f);
+}
+
+static void WriteClip(FILE *f, AnimClip clip) {
+    fprintf(f, "{ %d, %d, ", clip.start, clip.length);
+    WriteFloat(f, clip.speed);
+    fprintf(f, ", %s }", clip.loop ? "true" : "false");
+}
+
+static void WriteClips(FILE *f, const char *field, const AnimClip *clips, int count) {
+    fprintf(f, "        .%s = {\n", field);
+    for (int i = 0; i < count; i++) {
+        fprintf(f, "            ");
+        WriteClip(f, clips[i]);
+        fprintf(f, ",\n");
+    }
+    fprintf(f, "        },\n");
+}
+
+static void WriteTimelines(FILE *f, int index, const Moveset *moveset) {
+    for (int slot = 0; slot < MOVE_SLOT_COUNT; slot++) {
+        const Move *move = &moveset->list[slot];
+        if (move->frameCount == 0) continue;
+
+        fprintf(f, "static const unsigned short timeline_%d_%d[%d] = {", index, slot, move->frameCount);
+        for (int frame = 0; frame < move->frameCount; frame++) {
+            if (frame % 12 == 0) fprintf(f, "\n    ");
+            fprintf(f, "0x%04X,", move->timeline[frame]);
+        }
+        fprintf(f, "\n};\n");
+    }
+    fprintf(f, "\n");
+}
+
+static void WriteMove(FILE *f, int index, int slot, const Move *move) {
+    fprintf(f, "        {\n");
+    if (move->frameCount > 0) fprintf(f, "            .timeline = timeline_%d_%d,\n", index, slot);
+    fprintf(f, "            .frameCount = %d,\n", move->frameCount);
+    fprintf(f, "            .startupFrames = %d,\n", move->startupFrames);
+    fprintf(f, "            .activeFrames = %d,\n", move->activeFrames);
+    fprintf(f, "            .recoveryFrames = %d,\n", move->recoveryFrames);
+    fprintf(f, "            .type = %d,\n", move->type);
+    fprintf(f, "            .effect = %d,\n", move->effect);
+    fprintf(f, "            .hitbox = ");          WriteRectangle(f, move->hitbox);        fprintf(f, ",\n");
+    fprintf(f, "            .knockback = ");       WriteVector2(f, move->knockback);       fprintf(f, ",\n");
+    fprintf(f, "            .damage = ");          WriteFloat(f, move->damage);            fprintf(f, ",\n");
+    fprintf(f, "            .effectDuration = ");  WriteFloat(f, move->effectDuration);    fprintf(f, ",\n");
+    fprintf(f, "            .projectileSpeed = "); WriteVector2(f, move->projectileSpeed); fprintf(f, ",\n");
+    fprintf(f, "            .selfVelocity = ");    WriteVector2(f, move->selfVelocity);    fprintf(f, ",\n");
+    fprintf(f, "            .steerSpeed = ");      WriteFloat(f, move->steerSpeed);        fprintf(f, ",\n");
+    fprintf(f, "            .fallSpeed = ");       WriteFloat(f, move->fallSpeed);         fprintf(f, ",\n");
+    fprintf(f, "            .cooldownFrames = %d,\n", move->cooldownFrames);
+    fprintf(f, "            .trapDuration = ");    WriteFloat(f, move->trapDuration);      fprintf(f, ",\n");
+    fprintf(f, "            .maxCombo = %d,\n", move->maxCombo);
+    fprintf(f, "            .multiHit = %s,\n", move->multiHit ? "true" : "false");
+    fprintf(f, "            .canCombo = %s,\n", move->canCombo ? "true" : "false");
+    fprintf(f, "            .steerTurns = %s,\n", move->steerTurns ? "true" : "false");
+    fprintf(f, "        },\n");
+}
+
+static void WriteMoveset(FILE *f, int index, const Moveset *moveset) {
+    WriteTimelines(f, index, moveset);
+
+    fprintf(f, "static const Moveset moveset_%d = {\n", index);
+    fprintf(f, "    .list = {\n");
+    for (int slot = 0; slot < MOVE_SLOT_COUNT; slot++) WriteMove(f, index, slot, &moveset->list[slot]);
+    fprintf(f, "    },\n");
+
+    fprintf(f, "    .names = {\n");
+    for (int slot = 0; slot < MOVE_SLOT_COUNT; slot++) {
+        fprintf(f, "        ");
+        WriteString(f, moveset->names[slot]);
+        fprintf(f, ",\n");
+    }
+    fprintf(f, "    },\n");
+
+    fprintf(f, "    .anims = {\n");
+    WriteClips(f, "states", moveset->anims.states, PLAYER_STATE_COUNT);
+    WriteClips(f, "moves", moveset->anims.moves, MOVE_SLOT_COUNT);
+    WriteClips(f, "steering", moveset->anims.steering, MOVE_SLOT_COUNT);
+    fprintf(f, "    },\n");
+    fprintf(f, "};\n\n");
+}
+
+int main(int argc, char **argv) {
+    if (argc < 3) {
+        printf("Uso: movesetgen <saida.c> <moveset.json>...\n");
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    FILE *f = fopen(argv[1], "wb");
+    if (f == NULL) {
+        printf("ERRO: Nao foi possivel criar %s\n", argv[1]);
+        return 1;
+    }
+
+    fprintf(f, "// Gerado por tools/movesetgen. Nao editar: altere o JSON de origem.\n\n");
+    fprintf(f, "#include \"embedded_movesets.h\"\n");
+    fprintf(f, "#include <string.h>\n\n");
+
+    int count = argc - 2;
+    for (int i = 0; i < count; i++) {
+        Moveset *moveset = LoadMovesetFromJSON(argv[i + 2]);
+        if (moveset == NULL) {
+            fclose(f);
+            remove(argv[1]);
+            return 1;
+        }
+        WriteMoveset(f, i, moveset);
+        UnloadMoveset(moveset);
+    }
+
+    fprintf(f, "static const struct {\n    const char *fileName;\n    const Moveset *moveset;\n} embedded[%d] = {\n", count);
+    for (int i = 0; i < count; i++) {
+        fprintf(f, "    { ");
+        WriteString(f, argv[i + 2]);
+        fprintf(f, ", &moveset_%d },\n", i);
+    }
+    fprintf(f, "};\n\n");
+
+    fprintf(f, "const Moveset *EmbeddedMoveset_Find(const char *fileName) {\n");
+    fprintf(f, "    for (int i = 0; i < %d; i++) {\n", count);
+    fprintf(f, "        if (strcmp(embedded[i].fileName, fileName) == 0) return embedded[i].moveset;\n");
+    fprintf(f, "    }\n");
+    fprintf(f, "    return NULL;\n");
+    fprintf(f, "}\n");
+
+    fclose(f);
+    printf("movesetgen: %d moveset(s) em %s\n", count, argv[1]);
+    return 0;
+}
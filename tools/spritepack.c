@@ -0,0 +1,244 @@
+// Empacotador offline de folhas de sprite.
+//
+// Lê uma folha em grade de quadros fixos, recorta cada quadro até os pixels
+// opacos, junta quadros idênticos e grava um atlas compacto + metadados
+// (assets/<nome>.atlas.json) que o SpriteAtlas_Load do jogo consome.
+//
+// Uso: spritepack <folha.png> <larguraQuadro> <alturaQuadro> <saida.png> <saida.json>
+
+#include "raylib.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ATLAS_PADDING 1
+
+typedef struct {
+    int x, y, w, h;         // recorte dentro do quadro original
+    int unique;             // índice do quadro único que guarda os pixels
+} FrameInfo;
+
+typedef struct {
+    int frame;              // primeiro quadro com esses pixels
+    int w, h;
+    int atlasX, atlasY;
+    unsigned int hash;
+} UniqueFrame;
+
+static Color *sheetPixels;
+static int sheetWidth;
+static int sheetHeight;
+
+static Color GetPixel(int x, int y) {
+    return sheetPixels[y * sheetWidth + x];
+}
+
+// Menor retângulo com alpha > 0; largura 0 se o quadro for todo transparente
+static void TrimFrame(FrameInfo *info, int cellX, int cellY, int frameW, int frameH) {
+    int minX = frameW, minY = frameH, maxX = -1, maxY = -1;
+
+    // A última linha da folha pode estar cortada
+    if (cellY + frameH > sheetHeight) frameH = sheetHeight - cellY;
+
+    for (int y = 0; y < frameH; y++) {
+        for (int x = 0; x < frameW; x++) {
+            if (GetPixel(cellX + x, cellY + y).a == 0) continue;
+            if (x < minX) minX = x;
+            if (x > maxX) maxX = x;
+            if (y < minY) minY = y;
+            if (y > maxY) maxY = y;
+        }
+    }
+
+    if (maxX < 0) {
+        info->x = info->y = info->w = info->h = 0;
+        return;
+    }
+
+    info->x = minX;
+    info->y = minY;
+    info->w = maxX - minX + 1;
+    info->h = maxY - minY + 1;
+}
+
+static unsigned int HashRegion(int x0, int y0, int w, int h) {
+    unsigned int hash = 2166136261u;
+    for (int y = 0; y < h; y++) {
+        const unsigned char *row = (const unsigned char *)&sheetPixels[(y0 + y) * sheetWidth + x0];
+        for (int i = 0; i < w * 4; i++) {
+            hash ^= row[i];
+            hash *= 16777619u;
+        }
+    }
+    return hash;
+}
+
+static bool SameRegion(int ax, int ay, int bx, int by, int w, int h) {
+    for (int y = 0; y < h; y++) {
+        if (memcmp(&sheetPixels[(ay + y) * sheetWidth + ax],
+                   &sheetPixels[(by + y) * sheetWidth + bx], w * sizeof(Color)) != 0) return false;
+    }
+    return true;
+}
+
+static UniqueFrame *sortBase;
+
+static int CompareByHeight(const void *a, const void *b) {
+    const UniqueFrame *ua = &sortBase[*(const int *)a];
+    const UniqueFrame *ub = &sortBase[*(const int *)b];
+    if (ua->h != ub->h) return ub->h - ua->h;
+    return ub->w - ua->w;
+}
+
+// Prateleiras: quadros do mais alto ao mais baixo, da esquerda para a direita
+static int PackShelves(UniqueFrame *uniques, const int *order, int count, int atlasWidth) {
+    int cursorX = 0, cursorY = 0, shelfHeight = 0;
+
+    for (int i = 0; i < count; i++) {
+        UniqueFrame *u = &uniques[order[i]];
+        if (u->w == 0) continue;
+
+        if (cursorX + u->w + ATLAS_PADDING > atlasWidth) {
+            cursorX = 0;
+            cursorY += shelfHeight;
+            shelfHeight = 0;
+        }
+
+        u->atlasX = cursorX;
+        u->atlasY = cursorY;
+        cursorX += u->w + ATLAS_PADDING;
+        if (u->h + ATLAS_PADDING > shelfHeight) shelfHeight = u->h + ATLAS_PADDING;
+    }
+
+    return cursorY + shelfHeight;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 6) {
+        printf("Uso: %s <folha.png> <larguraQuadro> <alturaQuadro> <saida.png> <saida.json>\n", argv[0]);
+        return 1;
+    }
+
+    const char *sheetPath = argv[1];
+    int frameW = atoi(argv[2]);
+    int frameH = atoi(argv[3]);
+    const char *outImagePath = argv[4];
+    const char *outJsonPath = argv[5];
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    Image sheet = LoadImage(sheetPath);
+    if (sheet.data == NULL || frameW <= 0 || frameH <= 0) {
+        printf("ERRO: Nao foi possivel abrir %s\n", sheetPath);
+        return 1;
+    }
+    ImageFormat(&sheet, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    sheetPixels = (Color *)sheet.data;
+    sheetWidth = sheet.width;
+    sheetHeight = sheet.height;
+
+    int columns = sheet.width / frameW;
+    int rows = (sheet.height + frameH - 1) / frameH;
+    int frameCount = columns * rows;
+
+    FrameInfo *frames = (FrameInfo *)calloc(frameCount, sizeof(FrameInfo));
+    UniqueFrame *uniques = (UniqueFrame *)calloc(frameCount, sizeof(UniqueFrame));
+    int *order = (int *)malloc(frameCount * sizeof(int));
+    int uniqueCount = 0;
+    long trimmedArea = 0;
+
+    for (int i = 0; i < frameCount; i++) {
+        FrameInfo *info = &frames[i];
+        int cellX = (i % columns) * frameW;
+        int cellY = (i / columns) * frameH;
+        TrimFrame(info, cellX, cellY, frameW, frameH);
+
+        int srcX = cellX + info->x;
+        int srcY = cellY + info->y;
+        unsigned int hash = HashRegion(srcX, srcY, info->w, info->h);
+
+        info->unique = -1;
+        for (int u = 0; u < uniqueCount; u++) {
+            UniqueFrame *candidate = &uniques[u];
+            if (candidate->hash != hash || candidate->w != info->w || candidate->h != info->h) continue;
+
+            const FrameInfo *first = &frames[candidate->frame];
+            int firstX = (candidate->frame % columns) * frameW + first->x;
+            int firstY = (candidate->frame / columns) * frameH + first->y;
+            if (SameRegion(srcX, srcY, firstX, firstY, info->w, info->h)) {
+                info->unique = u;
+                break;
+            }
+        }
+
+        if (info->unique < 0) {
+            info->unique = uniqueCount;
+            uniques[uniqueCount] = (UniqueFrame){ i, info->w, info->h, 0, 0, hash };
+            order[uniqueCount] = uniqueCount;
+            trimmedArea += (long)(info->w + ATLAS_PADDING) * (info->h + ATLAS_PADDING);
+            uniqueCount++;
+        }
+    }
+
+    sortBase = uniques;
+    qsort(order, uniqueCount, sizeof(int), CompareByHeight);
+
+    // Largura em potência de dois próxima de um atlas quadrado
+    int atlasWidth = 64;
+    while ((long)atlasWidth * atlasWidth < trimmedArea) atlasWidth *= 2;
+    for (int u = 0; u < uniqueCount; u++) {
+        while (uniques[u].w + ATLAS_PADDING > atlasWidth) atlasWidth *= 2;
+    }
+    int atlasHeight = PackShelves(uniques, order, uniqueCount, atlasWidth);
+    if (atlasHeight < 1) atlasHeight = 1;
+
+    Image atlas = GenImageColor(atlasWidth, atlasHeight, BLANK);
+    Color *atlasPixels = (Color *)atlas.data;
+
+    for (int u = 0; u < uniqueCount; u++) {
+        const UniqueFrame *unique = &uniques[u];
+        const FrameInfo *info = &frames[unique->frame];
+        int srcX = (unique->frame % columns) * frameW + info->x;
+        int srcY = (unique->frame / columns) * frameH + info->y;
+
+        for (int y = 0; y < unique->h; y++) {
+            memcpy(&atlasPixels[(unique->atlasY + y) * atlasWidth + unique->atlasX],
+                   &sheetPixels[(srcY + y) * sheetWidth + srcX], unique->w * sizeof(Color));
+        }
+    }
+
+    if (!ExportImage(atlas, outImagePath)) {
+        printf("ERRO: Nao foi possivel gravar %s\n", outImagePath);
+        return 1;
+    }
+
+    FILE *f = fopen(outJsonPath, "w");
+    if (!f) {
+        printf("ERRO: Nao foi possivel gravar %s\n", outJsonPath);
+        return 1;
+    }
+
+    fprintf(f, "{\n  \"texture\": \"%s\",\n", outImagePath);
+    fprintf(f, "  \"frame_width\": %d,\n  \"frame_height\": %d,\n", frameW, frameH);
+    fprintf(f, "  \"frames\": [\n");
+    for (int i = 0; i < frameCount; i++) {
+        const FrameInfo *info = &frames[i];
+        const UniqueFrame *unique = &uniques[info->unique];
+        fprintf(f, "    { \"x\": %d, \"y\": %d, \"w\": %d, \"h\": %d, \"ox\": %d, \"oy\": %d }%s\n",
+                unique->atlasX, unique->atlasY, info->w, info->h, info->x, info->y,
+                (i < frameCount - 1) ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    fclose(f);
+
+    printf("SPRITEPACK: %s -> %s (%d quadros, %d unicos, %dx%d -> %dx%d)\n",
+           sheetPath, outImagePath, frameCount, uniqueCount,
+           sheet.width, sheet.height, atlasWidth, atlasHeight);
+
+    UnloadImage(atlas);
+    UnloadImage(sheet);
+    free(frames);
+    free(uniques);
+    free(order);
+    return 0;
+}
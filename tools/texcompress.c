@@ -0,0 +1,257 @@
+// Compressor offline de texturas para BC1/BC3 (DXT1/DXT5) em contêiner DDS.
+//
+// Lê o manifesto (assets/data/textures.json) e, para cada entrada não isenta,
+// grava <destino>/<nome>.dds ao lado do original. O Assets_LoadTexture do jogo
+// prefere o .dds quando ele existe.
+//
+// Uso: texcompress <manifesto.json> <pastaOrigem> <pastaDestino>
+
+#include "raylib.h"
+#include "cJSON.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DDS_MAGIC 0x20534444
+#define DDSD_CAPS 0x1
+#define DDSD_HEIGHT 0x2
+#define DDSD_WIDTH 0x4
+#define DDSD_PIXELFORMAT 0x1000
+#define DDSD_MIPMAPCOUNT 0x20000
+#define DDSD_LINEARSIZE 0x80000
+#define DDPF_FOURCC 0x4
+#define DDSCAPS_TEXTURE 0x1000
+
+typedef enum {
+    FORMAT_BC1,
+    FORMAT_BC3
+} BlockFormat;
+
+static void WriteU32(FILE *f, unsigned int value) {
+    unsigned char bytes[4] = { value & 0xFF, (value >> 8) & 0xFF, (value >> 16) & 0xFF, (value >> 24) & 0xFF };
+    fwrite(bytes, 1, 4, f);
+}
+
+static unsigned short To565(int r, int g, int b) {
+    return (unsigned short)(((r * 31 + 127) / 255) << 11 | ((g * 63 + 127) / 255) << 5 | ((b * 31 + 127) / 255));
+}
+
+static Color From565(unsigned short c) {
+    int r = (c >> 11) & 31, g = (c >> 5) & 63, b = c & 31;
+    return (Color){ (r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2), 255 };
+}
+
+static int ColorDistance(Color a, Color b) {
+    int dr = a.r - b.r, dg = a.g - b.g, db = a.b - b.b;
+    return dr * dr + dg * dg + db * db;
+}
+
+// Extremos pela caixa envolvente, na diagonal que acompanha a correlação
+// dos canais com o verde, recuados 1/16 para não desperdiçar a paleta.
+static void EncodeColorBlock(const Color block[16], unsigned char out[8]) {
+    int minC[3] = { 255, 255, 255 }, maxC[3] = { 0, 0, 0 };
+    float mean[3] = { 0 };
+
+    for (int i = 0; i < 16; i++) {
+        const unsigned char ch[3] = { block[i].r, block[i].g, block[i].b };
+        for (int c = 0; c < 3; c++) {
+            if (ch[c] < minC[c]) minC[c] = ch[c];
+            if (ch[c] > maxC[c]) maxC[c] = ch[c];
+            mean[c] += ch[c] / 16.0f;
+        }
+    }
+
+    float covRG = 0.0f, covBG = 0.0f;
+    for (int i = 0; i < 16; i++) {
+        float g = block[i].g - mean[1];
+        covRG += (block[i].r - mean[0]) * g;
+        covBG += (block[i].b - mean[2]) * g;
+    }
+    if (covRG < 0.0f) { int t = minC[0]; minC[0] = maxC[0]; maxC[0] = t; }
+    if (covBG < 0.0f) { int t = minC[2]; minC[2] = maxC[2]; maxC[2] = t; }
+
+    for (int c = 0; c < 3; c++) {
+        int inset = (maxC[c] - minC[c]) / 16;
+        maxC[c] -= inset;
+        minC[c] += inset;
+    }
+
+    unsigned short c0 = To565(maxC[0], maxC[1], maxC[2]);
+    unsigned short c1 = To565(minC[0], minC[1], minC[2]);
+
+    // c0 > c1 seleciona o modo de 4 cores (sem transparência de 1 bit)
+    if (c0 < c1) { unsigned short t = c0; c0 = c1; c1 = t; }
+
+    unsigned int indices = 0;
+    if (c0 != c1) {
+        Color palette[4];
+        palette[0] = From565(c0);
+        palette[1] = From565(c1);
+        palette[2] = (Color){ (2 * palette[0].r + palette[1].r) / 3, (2 * palette[0].g + palette[1].g) / 3, (2 * palette[0].b + palette[1].b) / 3, 255 };
+        palette[3] = (Color){ (palette[0].r + 2 * palette[1].r) / 3, (palette[0].g + 2 * palette[1].g) / 3, (palette[0].b + 2 * palette[1].b) / 3, 255 };
+
+        for (int i = 0; i < 16; i++) {
+            int best = 0, bestDistance = ColorDistance(block[i], palette[0]);
+            for (int p = 1; p < 4; p++) {
+                int distance = ColorDistance(block[i], palette[p]);
+                if (distance < bestDistance) { best = p; bestDistance = distance; }
+            }
+            indices |= (unsigned int)best << (2 * i);
+        }
+    }
+
+    out[0] = c0 & 0xFF; out[1] = c0 >> 8;
+    out[2] = c1 & 0xFF; out[3] = c1 >> 8;
+    out[4] = indices & 0xFF; out[5] = (indices >> 8) & 0xFF;
+    out[6] = (indices >> 16) & 0xFF; out[7] = (indices >> 24) & 0xFF;
+}
+
+static void EncodeAlphaBlock(const Color block[16], unsigned char out[8]) {
+    int a0 = 0, a1 = 255;
+    for (int i = 0; i < 16; i++) {
+        if (block[i].a > a0) a0 = block[i].a;
+        if (block[i].a < a1) a1 = block[i].a;
+    }
+
+    unsigned long long indices = 0;
+    if (a0 != a1) {
+        // a0 > a1: oito níveis interpolados
+        int palette[8] = { a0, a1 };
+        for (int p = 2; p < 8; p++) palette[p] = ((8 - p) * a0 + (p - 1) * a1) / 7;
+
+        for (int i = 0; i < 16; i++) {
+            int best = 0, bestDistance = abs(block[i].a - palette[0]);
+            for (int p = 1; p < 8; p++) {
+                int distance = abs(block[i].a - palette[p]);
+                if (distance < bestDistance) { best = p; bestDistance = distance; }
+            }
+            indices |= (unsigned long long)best << (3 * i);
+        }
+    }
+
+    out[0] = (unsigned char)a0;
+    out[1] = (unsigned char)a1;
+    for (int b = 0; b < 6; b++) out[2 + b] = (indices >> (8 * b)) & 0xFF;
+}
+
+static bool CompressTexture(const char *srcPath, const char *dstPath, BlockFormat format) {
+    Image image = LoadImage(srcPath);
+    if (image.data == NULL) {
+        printf("ERRO: Nao foi possivel abrir %s\n", srcPath);
+        return false;
+    }
+    ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    const Color *pixels = (const Color *)image.data;
+
+    int blocksX = (image.width + 3) / 4;
+    int blocksY = (image.height + 3) / 4;
+    int blockSize = (format == FORMAT_BC1) ? 8 : 16;
+    unsigned int linearSize = (unsigned int)(blocksX * blocksY * blockSize);
+
+    FILE *f = fopen(dstPath, "wb");
+    if (!f) {
+        printf("ERRO: Nao foi possivel gravar %s\n", dstPath);
+        UnloadImage(image);
+        return false;
+    }
+
+    // Cabeçalho DDS (124 bytes) com um único nível de mipmap
+    WriteU32(f, DDS_MAGIC);
+    WriteU32(f, 124);
+    WriteU32(f, DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_MIPMAPCOUNT | DDSD_LINEARSIZE);
+    WriteU32(f, image.height);
+    WriteU32(f, image.width);
+    WriteU32(f, linearSize);
+    WriteU32(f, 0);
+    WriteU32(f, 1);
+    for (int i = 0; i < 11; i++) WriteU32(f, 0);
+
+    WriteU32(f, 32);
+    WriteU32(f, DDPF_FOURCC);
+    fwrite((format == FORMAT_BC1) ? "DXT1" : "DXT5", 1, 4, f);
+    for (int i = 0; i < 5; i++) WriteU32(f, 0);
+
+    WriteU32(f, DDSCAPS_TEXTURE);
+    for (int i = 0; i < 4; i++) WriteU32(f, 0);
+
+    for (int by = 0; by < blocksY; by++) {
+        for (int bx = 0; bx < blocksX; bx++) {
+            // Bordas que não fecham um bloco repetem o último pixel
+            Color block[16];
+            for (int y = 0; y < 4; y++) {
+                int py = by * 4 + y;
+                if (py >= image.height) py = image.height - 1;
+                for (int x = 0; x < 4; x++) {
+                    int px = bx * 4 + x;
+                    if (px >= image.width) px = image.width - 1;
+                    block[y * 4 + x] = pixels[py * image.width + px];
+                }
+            }
+
+            unsigned char encoded[16];
+            if (format == FORMAT_BC3) {
+                EncodeAlphaBlock(block, encoded);
+                EncodeColorBlock(block, encoded + 8);
+            } else {
+                EncodeColorBlock(block, encoded);
+            }
+            fwrite(encoded, 1, blockSize, f);
+        }
+    }
+    fclose(f);
+
+    printf("TEXCOMPRESS: %s -> %s (%dx%d, %u KB -> %u KB)\n", srcPath, dstPath,
+           image.width, image.height, (unsigned int)(image.width * image.height * 4 / 1024), linearSize / 1024);
+
+    UnloadImage(image);
+    return true;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 4) {
+        printf("Uso: %s <manifesto.json> <pastaOrigem> <pastaDestino>\n", argv[0]);
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    char *data = LoadFileText(argv[1]);
+    if (data == NULL) {
+        printf("ERRO: Nao foi possivel abrir %s\n", argv[1]);
+        return 1;
+    }
+
+    cJSON *root = cJSON_Parse(data);
+    UnloadFileText(data);
+    if (!root) {
+        printf("ERRO: JSON invalido em %s\n", argv[1]);
+        return 1;
+    }
+
+    int failures = 0;
+    cJSON *entry = NULL;
+    cJSON_ArrayForEach(entry, cJSON_GetObjectItem(root, "textures")) {
+        cJSON *file = cJSON_GetObjectItem(entry, "file");
+        if (!cJSON_IsString(file)) continue;
+
+        // Pixel art que precisa ficar sem perdas (paleta, fontes) fica de fora
+        if (cJSON_IsTrue(cJSON_GetObjectItem(entry, "exempt"))) continue;
+
+        cJSON *formatName = cJSON_GetObjectItem(entry, "format");
+        BlockFormat format = FORMAT_BC1;
+        if (cJSON_IsString(formatName) && strcmp(formatName->valuestring, "BC3") == 0) format = FORMAT_BC3;
+
+        char srcPath[512], dstPath[512];
+        snprintf(srcPath, sizeof(srcPath), "%s/%s", argv[2], file->valuestring);
+        snprintf(dstPath, sizeof(dstPath), "%s/%s", argv[3], file->valuestring);
+
+        char *ext = strrchr(dstPath, '.');
+        if (ext != NULL && strlen(ext) >= 4) strcpy(ext, ".dds");
+        else strncat(dstPath, ".dds", sizeof(dstPath) - strlen(dstPath) - 1);
+
+        if (!CompressTexture(srcPath, dstPath, format)) failures++;
+    }
+
+    cJSON_Delete(root);
+    return (failures > 0) ? 1 : 0;
+}